@@ -42,16 +42,33 @@ namespace CVED {
         } dist;
     }TTrafficCloudData;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// A traveler can be kept and moved with SetPos to query the traffic
+    /// around many positions; it keeps the buffers it needs between calls.
+    /// The traffic clouds of many vehicles can be computed on several threads
+    /// with the static GetTrafficCloudInformation.
+    ///////////////////////////////////////////////////////////////////////////
     class CRoadTraveler
     {
     public:
         CRoadTraveler(CVED::CRoadPos& pos, const CVED::CCved&, CVED::CPath& = CVED::CPath());
+        void SetPos(const CVED::CRoadPos& pos);
         bool Travel(float&, std::vector<int>& objects, std::vector<float>& dists, int ignoreId = -1);
         TTrafficCloudData GetTrafficCloudInformation(
             float dist, int id);
+        void GetTrafficCloudInformation(
+            float dist, int id, TTrafficCloudData& res);
+        static void GetTrafficCloudInformation(
+            const CVED::CCved&,
+            const std::vector<CVED::CRoadPos>& positions,
+            const std::vector<int>& ids,
+            float dist,
+            std::vector<TTrafficCloudData>& res,
+            int numThreads = 0);
 
         ~CRoadTraveler(void);
     private:
+        bool TravelFrom(CVED::CRoadPos& pos, float&, std::vector<int>& objects, std::vector<float>& dists, int ignoreId);
         bool TravelPriv(float&, float&, CVED::CRoadPos& pos, std::vector<int>& objects, std::vector<float>& dists, int ignoreId = -1);
         bool TravelPrivRoad(float&, float&, CVED::CRoadPos& pos, std::vector<int>& objects, std::vector<float>& dists, int ignoreId = -1);
         bool TravelPrivCrdr(float&, float&, CVED::CRoadPos& pos, std::vector<int>& objects, std::vector<float>& dists, int ignoreId = -1);
@@ -60,6 +77,11 @@ namespace CVED {
         CVED::CRoadPos m_pos;
         CVED::CPath m_path;
         const CVED::CCved& m_cCved;
+        // buffers reused by every call
+        std::vector<CVED::CCved::TObjWithDist> m_objs;
+        CVED::TCrdrVec m_crdrs;
+        CVED::TCrdrVec m_srcCrdrs;
+        CVED::TCrdrVec m_destCrdrs;
     };
 
 }
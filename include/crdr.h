@@ -21,6 +21,7 @@ using namespace std;
 struct cvTIntrsctn;
 struct cvTCrdr;
 struct cvTCrdrCntrlPnt;
+struct cvTCrdrMrgDst;
 
 namespace CVED {
 
@@ -161,6 +162,8 @@ protected:
 	void		AssertValid(void) const;
 
 private:	
+	const struct cvTCrdrMrgDst*	GetMrgDstEntry( int crdrId ) const;
+
 	TCrdr*		m_pCrdr;
 };
 
@@ -49,6 +49,64 @@ namespace CVED {
 // the CVED shared memory key
 #define cCVED_SHARED_MEM_KEY_ENV  "CvedMem"
 	class CTrafLightData;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Geometry of the segment that starts at a road control point.  It is
+// derived from the control point pool when the LRI file is loaded so
+// that converting a road position to world coordinates does not have
+// to recompute it.
+//
+struct TRoadSegGeom {
+	double	invLength;		// 1 / linear distance to the next cntrl pnt
+	double	orthoI;			// unit vector orthogonal to the segment
+	double	orthoJ;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Geometry of the segment that starts at a corridor control point.  The
+// tangent chords are the ones blended by CRoadPos::GetTangentInterpolated,
+// which skips control points closer than 10 ft to the previous one.
+//
+struct TCrdrSegGeom {
+	double	invLength;		// 1 / distance to the next cntrl pnt
+	double	orthoI;			// unit vector orthogonal to the segment
+	double	orthoJ;
+	double	tan1I;			// chord from this cntrl pnt
+	double	tan1J;
+	double	tan2I;			// following chord; 0 on the last one
+	double	tan2J;
+	double	invTanLength;	// 1 / length of the first chord
+	bool	hasTan2;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// A corridor that crosses or merges with another corridor of the same
+// intersection.  The distances are measured along the corridor that owns
+// the entry and are copied from its row of the merge distance matrix.
+//
+struct TCrdrConflict {
+	int		crdrId;			// relative id of the other corridor
+	double	firstDist;		// where the corridors first meet
+	double	lastDist;		// where they separate, or -1 if they do not
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Where the hold offset lookahead goes from the end of a lane.  The
+// corridors leaving the lane are taken in the order of their intersection;
+// when none of them has a hold offset, the lookahead continues along the
+// first straight corridor, or the first corridor if none is straight.
+//
+struct TLaneHldOfsLink {
+	int		hldOfsCrdr;		// first corridor with a hold offset, or 0
+	int		nextLane;		// lane the lookahead continues on, or -1
+	double	nextDist;		// length of the followed corridor plus the
+							//	length of the road of nextLane
+};
+
 //////////////////////////////////////////////////////////////////////////////
 ///
 /// Description:
@@ -122,13 +180,15 @@ public:
 	enum ECvedMode { eCV_SINGLE_USER, eCV_MULTI_USER };
 
 	// System related
-	bool		Configure(ECvedMode, double deltaT, int dynaMult);
+	bool		Configure(ECvedMode, double deltaT, int dynaMult,
+				int numDynObjs = cNUM_DYN_OBJS);
 	bool		Attach(void);
 	bool		Init(const string& cLriName, string& errMsg);
 	void		ReInit(void);
 	virtual void Maintainer(void);
 	virtual void ExecuteDynamicModels();
 	void		SetDebug(int level);
+	int			GetDynObjCapacity(void) const;
 
 	// SOL related
 	static const CSol& GetSol();
@@ -231,14 +291,18 @@ public:
 	void		GetAllRoadPieces(vector<CRoadPiece>& out) const;
 	CRoad		GetRoad(int) const;
 	CRoad		GetRoad(const string&) const;
+	int			GetRoadIdByName(const string&) const;
 
 	// Intersection related
 	void		GetAllIntersections(TIntrsctnVec&) const;
 	CIntrsctn   GetIntersection(int) const;
 	CIntrsctn   GetIntersection(const string&) const;
+	int			GetIntrsctnIdByName(const string&) const;
 	int         GetNumIntersections() const;
     // corridor related
     bool        GetCrdrsCntrlPointsNear(const CPoint3D&,int crdrId,TIntVec&) const;
+	// route planning
+	const CRouteGraph&	GetRouteGraph() const;
 
 	// Object related
 
@@ -273,6 +337,10 @@ public:
 					TIntVec&,
 					CObjTypeMask	m=CObjTypeMask::m_all
 					) const;
+	void		GetChangedStaticObjs(
+					TU8b			changedId,
+					TIntVec&
+					) const;
 
 	void 		GetAllDynObjsOnRoad(
 					int roadId,
@@ -379,6 +447,35 @@ public:
 					const CObjTypeMask& objMask,
 					vector<TObjListInfo>& apprchObjs
 					);
+
+	// Building the object lists of many objects at once
+	typedef enum {
+		eFWD_OBJ_LIST,
+		eBACK_OBJ_LIST,
+		eBACK_OBJ_LIST2,
+		eONCOMING_OBJ_LIST,
+		eAPPRCH_OBJ_LIST
+	} EObjListKind;
+	typedef struct TObjListRequest {
+		EObjListKind			kind;
+		int						ownerObjId;
+		const CRoadPos*			pRoadPos;
+		const class CPath*		pPath;		// not used by the back lists
+		const CRoad*			pPrevRoad;	// used by eBACK_OBJ_LIST2 only
+		int						maxObjs;
+		CObjTypeMask			objMask;
+		vector<TObjListInfo>	objs;		// (output) the object list
+	} TObjListRequest;
+	void		BuildObjLists(
+					vector<TObjListRequest>& requests,
+					int numThreads = 0
+					);
+
+	// Reusing the results of identical queries within a frame
+	void		SetQryMemo(bool enable);
+	bool		GetQryMemo(void) const;
+	void		GetQryMemoStats(int& hits, int& misses) const;
+	void		ResetQryMemoStats(void);
 	int			GetFirstObjOnIntrsctingCrdr(
 					int crdrId,
 					const CCrdr& interCrdr,
@@ -493,6 +590,8 @@ public:
 	void        GetEnvArea(const CPoint2D&, vector<CEnvArea>&);
 	void        GetEnvArea(const CPoint3D&, vector<CEnvArea>&);
 	void        GetEnvArea(double, double, vector<CEnvArea>&);
+	void        GetEnvArea(double, double, vector<const CEnvArea*>&) const;
+	void        GetEnvAreaIds(double, double, vector<int>&) const;
 	bool        CreateEnvArea(
 						vector<cvTEnviroInfo>& info,
 						vector<CPoint2D>& polyPts,
@@ -652,12 +751,30 @@ protected:
 
 	void MemBlockInit(void);
 	void ClassInit(void);
+	void BuildRouteGraph(void);
+	void BuildSegGeom(void);
+	void BuildCrdrConflicts(void);
+	void BuildHldOfsLinks(void);
+	void BuildAttrIdx(void);
+	void BuildEnvAreaQTree(void);
 	void GetSegment(cvTCntrlPnt*, cvTCntrlPnt*, CPoint2D*);
 	void GetSegment(cvTCntrlPnt*, CPoint2D*);
 	bool GetObjLinear(const string&, int& objId) const;
+	void AddObjName(const string&, int objId);
+	void RemoveObjName(const string&, int objId);
 
 	enum EState {eUNCONFIGURED, eCONFIGURED, eACTIVE};
-	typedef map<string, int>  TStr2IntMap;
+	// one entry of the name index; an identifier of 0 means that no
+	// road (intersection) carries the name.  Lanes and corridors are
+	// named relative to their road and intersection, so they are
+	// reached through the entry of their parent.
+	struct TNameIdxEntry {
+		TNameIdxEntry() : roadId(0), intrsctnId(0) {}
+		int			roadId;
+		int			intrsctnId;
+		vector<int>	objIds;		// objects with the name, any phase
+	};
+	typedef unordered_map<string, TNameIdxEntry>  TNameIdx;
 	typedef CTerrainGrid<Post> *CTerrainGridPtr;
     typedef std::unique_ptr<CQuadTree> TQtreeRef;
     typedef std::pair<int, TQtreeRef> TQtreeIdRef;
@@ -675,16 +792,113 @@ protected:
 	CQuadTree	m_intrsctnQTree;	// quadtree for intersection
 	CQuadTree	m_staticObjQTree;	// quadtree for staic objects
 	CQuadTree	m_trrnObjQTree;		// quadtree for the objects of type terrain
+	CQuadTree	m_envAreaQTree;		// quadtree for the areas in m_envAreas
     TQtreeMap   m_intersectionMap; //<
 
 	static CSol m_sSol;         // Sol library that is the same for all
 								//	CCved instances
-	TStr2IntMap	m_roadNameMap;		// maps road names to road identifiers
-	TStr2IntMap	m_intrsctnNameMap;	// maps intersection names to identifiers
-	CDynObj*	m_dynObjCache[cNUM_DYN_OBJS];
+	TNameIdx	m_nameIdx;			// maps names of roads, intersections
+									//	and objects to their identifiers
+	int			m_numDynObjs;	// dynamic object slots in use, set by
+							//	Configure; at most cNUM_DYN_OBJS
+	vector<CDynObj*>	m_dynObjCache;
+
+	// the lead object GetLeadObj last found for each dynamic object on
+	// its own lane; it is checked against the reference lists before
+	// being used again.  The entries are written by the const GetLeadObj
+	// without a lock, each one only by the calls for its own object.
+	struct TLeadObjHint {
+		int			laneId;			// lane of the object, or -1 if none
+		int			leadObjId;
+	};
+	mutable vector<TLeadObjHint> m_leadObjHints;
 
 	vector<CPolygon2D>  m_intrsctnBndrs;	// intersection boundary polys
 	vector<CTerrainGridPtr> m_intrsctnGrids;	// intersection elev maps
+	CRouteGraph			m_routeGraph;		// road graph used for routing
+	vector<TRoadSegGeom> m_roadSegGeom;		// per road cntrl pnt
+	vector<TCrdrSegGeom> m_crdrSegGeom;		// per crdr cntrl pnt
+	vector<TCrdrConflict> m_crdrConflicts;	// sorted by corridor
+	vector<int>			m_firstCrdrConflict;// first entry of each crdr,
+											//	plus one at the end
+	vector<int>			m_dstLnCrdrs;		// crdr ids sorted by dst lane
+	vector<int>			m_firstDstLnCrdr;	// first entry of each lane,
+											//	plus one at the end
+	vector<TLaneHldOfsLink> m_laneHldOfsLinks;	// per lane
+	vector<int>			m_roadAttrs;		// attrs compiled into the LRI
+											//	file, by road, then by id
+											//	and starting distance
+	vector<int>			m_firstRoadAttr;	// first entry of each road,
+											//	plus one at the end
+	vector<int>			m_intrsctnAttrs;	// same, by intersection
+	vector<int>			m_firstIntrsctnAttr;
+
+	// results of the queries made during the current frame, kept while
+	// memoization is enabled; see SetQryMemo
+	typedef enum {
+		eQRY_DYN_OBJS_ON_ROAD,
+		eQRY_OBJS_NEAR,
+		eQRY_TRAF_LIGHTS_NEAR
+	} EQryMemoKind;
+	struct TQryMemoKey {
+		TQryMemoKey(
+				EQryMemoKind kind,
+				int id,
+				TU32b lanes,
+				const CObjTypeMask& cMask,
+				const CPoint3D& cLoc,
+				double radius
+				);
+		bool operator<(const TQryMemoKey&) const;
+
+		EQryMemoKind	kind;
+		int				id;			// road id or maximum size
+		TU32b			lanes;
+		TU32b			mask;		// one bit per object type
+		double			x, y, z;
+		double			radius;
+	};
+	typedef map<TQryMemoKey, TIntVec>  TQryMemo;
+	bool				m_qryMemoEnabled;
+	mutable TU32b		m_qryMemoFrame;		// frame of the results
+	mutable int			m_qryMemoHits;
+	mutable int			m_qryMemoMisses;
+	mutable TQryMemo	m_qryMemo;
+
+	const TIntVec*	FindQryMemo(const TQryMemoKey&) const;
+	void			AddQryMemo(
+						const TQryMemoKey&,
+						TIntVec::const_iterator first,
+						TIntVec::const_iterator last
+						) const;
+	void			ClearQryMemo(void);
+
+	// the static objects changed through this instance, in order of
+	// change; entry i is kept in slot i % cCV_CHANGE_JOURNAL_SIZE
+	int				m_changeJournal[cCV_CHANGE_JOURNAL_SIZE];
+	TU32b			m_changeJournalEnd;	// number of entries written
+	mutable TU32b	m_changeJournalRead[cCV_NUM_CHANGE_CONSUMERS];
+										// number of entries read by each
+										//	consumer
+	void			MarkObjChanged(int objId);
+	void			ResetChangeJournal(void);
+
+	// the phase and type of each dynamic object, kept in step with the
+	// object pool so that scans over all the slots do not have to touch
+	// the large cvTObj records; they are only valid in the instance that
+	// owns the object pool, so they are read through GetDynObjPhase and
+	// GetDynObjType, which use the pool in attached instances
+	mutable vector<TU8b>	m_dynObjPhase;
+	vector<TU8b>	m_dynObjType;
+	void			SetDynObjPhase(int objId, int phase) const;
+	int				GetDynObjPhase(int objId) const;
+	int				GetDynObjType(int objId) const;
+	void			SizeDynObjArrays(int numDynObjs);
+
+	// scratch lists of ExecuteDynamicModels, kept between frames so
+	// that their memory is reused
+	vector<TObjectPoolIdx>	m_attachedObjIds;
+	vector<TObjectPoolIdx>	m_freeMotionObjIds;
 
 	// functions that help access internal pools
 	cvTObj*			BindObj(TObjectPoolIdx) const;
@@ -716,6 +930,15 @@ protected:
 	int	GetObjWithClosestDistOnLane(
 							 CLane& srcLane,
 							 vector<TObjWithDist>& objs );
+	bool GetTrackedLeadObj(
+				int objId,
+				const CLane& lane,
+				bool withRoadDir,
+				const CObjTypeMask& objMask,
+				double objDist,
+				int& leadObjId,
+				double& followDist
+				) const;
 	int GetClosestObjBehindOnCrdr(
 							 int obj,
 							 double intersectingCrdrLength,
@@ -765,8 +988,6 @@ protected:
 	CVector3D   m_NullQueryNorm;
 	int         m_NullQueryMaterial;
 
-	multimap<string, int> m_objNameToId;
-
 	// environment areas
 	vector<CEnvArea> m_envAreas;
 
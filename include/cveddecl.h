@@ -106,6 +106,14 @@ extern "C" {
  */
 #define	cCV_NUM_DYN_OBJ_REFS	1+cNUM_DYN_OBJS*cCV_NUM_DOR_REPS
 
+/*
+ * The number of changes to static objects remembered for the consumers
+ *	of CCved::GetChangedStaticObjs, and the number of such consumers, one
+ *	per bit of the changedFlag of an object.
+ */
+#define cCV_CHANGE_JOURNAL_SIZE		4096
+#define cCV_NUM_CHANGE_CONSUMERS	8
+
 /*
  * The number of dynamic objects slots that can be used
  * by externally specified  and controlled objects (generally
@@ -30,6 +30,10 @@ struct cvTCrdr;
 namespace CVED {
 	
 class CCved;
+struct TRoadSegGeom;
+struct TCrdrSegGeom;
+struct TCrdrConflict;
+struct TLaneHldOfsLink;
 
 /////////////////////////////////////////////////////////////////////////////
 //
@@ -74,6 +78,17 @@ protected:
 
 	const CTerrainGrid<Post>*
 						GetIntrsctnGrid(int) const;
+	const CPolygon2D&	GetIntrsctnBorder(int) const;
+	const TRoadSegGeom&	GetRoadSegGeom(int) const;
+	const TCrdrSegGeom&	GetCrdrSegGeom(int) const;
+	const TCrdrConflict*
+						GetCrdrConflicts(int, int&) const;
+	const int*			GetDstLnCrdrs(int, int&) const;
+	const TLaneHldOfsLink&
+						GetLaneHldOfsLink(int) const;
+	const int*			GetRoadAttrs(int, int&) const;
+	const int*			GetIntrsctnAttrs(int, int&) const;
+	void				SetDynObjPhase(int, int) const;
 
 private:
 	const CCved*		m_cpCved;
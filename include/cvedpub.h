@@ -35,9 +35,11 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <deque>
 #include <set>
 #include <bitset>
 #include <map>
+#include <unordered_map>
 #include <memory>
 #include <algorithm>
 #include <tuple>
@@ -63,6 +65,7 @@ using namespace std;
 #include "cvedversionnum.h"
 #include "sol2.h"
 #include "undeletable_ptr.h"
+#include "smallvec.h"
 using namespace std;
 #include "sharedmem.h"
 #include "Orientation.h"
@@ -89,9 +92,11 @@ using namespace std;
 #include "dynobj.h"
 #include "reconfobj.h"
 #include "odePublic.h"
+#include "routegraph.h"
 #include "cved.h"
 #include "cntrlpnt.h"
 #include "path.h"
+#include "pathcursor.h"
 #include "pathnetwork.h"
 #include "ExternalControlInterface.h"
 #include <DebugStream.h>
@@ -188,6 +188,14 @@ typedef struct cvTHeader {
 /* the following fields are unitialized in the compiled lri file */
 	int             initialized;	   /* until set, clients can't use */
 	TU32b           numClients;
+
+/* fields added after the layout above was fixed; they are kept at the end
+ * so that the fields above stay at the same offsets */
+	TU32b			routeHierNodeCount;/* number of route hierarchy nodes, */
+									   /* 0 if the hierarchy was not built */
+	TU32b			routeHierNodeOfs;  /* offset */
+	TU32b			routeHierEdgeCount;/* number of route hierarchy edges */
+	TU32b			routeHierEdgeOfs;  /* offset */
 } cvTHeader;
 
 const size_t gcCVED_HeaderSize = sizeof(cvTHeader);
@@ -571,6 +579,36 @@ typedef struct cvTCrdrMrgDst{
 
 const size_t gcCVED_TCrdrMrgDstSize = sizeof(cvTCrdrMrgDst);
 
+/*
+ * these structures represent the optional route hierarchy computed by
+ * the lri compiler.  Each node is a road traveled in one direction, with
+ * index 2 * road id for the positive direction and 2 * road id + 1 for
+ * the negative direction; the pool has one extra node at the end so the
+ * edges of node i are those between its first index and the first index
+ * of node i + 1.  Upward edges lead from a node to a node of higher rank
+ * and are stored with their source, downward edges lead from a node of
+ * higher rank to a node of lower rank and are stored with their target.
+ */
+typedef struct cvTRouteHierNode{
+	int						rank;			/* order of contraction */
+	int						firstUpEdge;	/* index of first upward edge */
+	int						firstDownEdge;	/* index of first downward edge */
+} cvTRouteHierNode;
+
+const size_t gcCVED_TRouteHierNodeSize = sizeof(cvTRouteHierNode);
+
+typedef struct cvTRouteHierEdge{
+	int						node;			/* node at the other end */
+	int						middle;			/* node bypassed by a shortcut, */
+											/* -1 for a corridor */
+	int						crdrId;			/* corridor id relative to its */
+											/* intersection, -1 for shortcut*/
+	double					length;			/* length of the road traveled */
+											/* plus the corridor(s) */
+} cvTRouteHierEdge;
+
+const size_t gcCVED_TRouteHierEdgeSize = sizeof(cvTRouteHierEdge);
+
 /*
  * this structures represent the border segment of the lri file
  */
@@ -64,6 +64,13 @@ int		FindDorIdx (TObjectPoolIdx objId);
 void	DumpDynObjRefLists(ostream& out = cout);
 void	LinkDorIntoList(TObjectPoolIdx dorIdx);
 bool	IsObjOnRoadNetwork(const cvTObj* pObj);
+
+// These methods return the entry of an object in the list of a given
+//	road or intersection, or 0 if the object is not on it.  They read
+//	the fixed slots of the object in the dynamic object reference pool
+//	instead of searching the list.
+const cvTDynObjRef*	GetRoadDynObjRef(int objId, int roadId) const;
+const cvTDynObjRef*	GetIntrsctnDynObjRef(int objId, int intrsctnId) const;
 int		SearchAroundPrevLocation(
 			const string& spc,
 			TObjectPoolIdx objId,
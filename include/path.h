@@ -29,6 +29,8 @@
 #include "pathpoint.h"
 
 namespace CVED {
+
+class CPathCursor;
 	
 class CPath : public CCvedItem {
 
@@ -137,6 +139,18 @@ class CPath : public CCvedItem {
 							CRoadPos&, 
 							bool strictConnectivity = true 
 							);
+
+		bool			SetCursor( const CRoadPos&, CPathCursor& ) const;
+		ETravelCode		Travel( 
+							double, 
+							CPathCursor&, 
+							bool strictConnectivity = true 
+							) const;
+		ETravelCode		TravelBack( 
+							double, 
+							CPathCursor&, 
+							bool strictConnectivity = true 
+							) const;
 		void			SwitchLane( int );
 		void			SwitchLane( const CLane& );
 		
@@ -210,42 +224,13 @@ class CPath : public CCvedItem {
 		vector<CPoint2D> GetOutline( double extra = 1.0f ) const;
 
 		bool CalculateRoute(CRoadPos& start, CRoadPos& end, double& totalDist, bool clear = true, bool shortest = false, int maxHeight = 25) ;
+		bool CalculateShortestRoute(CRoadPos& start, CRoadPos& end, double& totalDist, bool clear = true) ;
 		bool AppendRoute(CRoadPos end, double& totalDist, bool shortest = false, int maxHeight = 25) ;
 
         bool            ValidatePath() const;
 		// Inherited functions 
 		bool			IsValid() const override;          
 
-		// used for route calculation
-		struct TRouteNode {
-			// IDs for navigation
-		
-			//absolute ID
-			int srcRoadIdx;
-			int roadIdx;
-			cvELnDir roadDir;
-
-			// relative IDs
-			int srcCrdrId;
-			int srcLaneId;
-
-			// length of segment
-			double length;
-
-			// tree info
-			bool head;
-			TRouteNode* parent;
-			std::vector<TRouteNode> children;
-			bool searched; // denotes whether or not node has searched for children
-
-			// used for optimization
-			double linearDistSquared;	// square of the distance to the destination
-			int awayNodes;	// number of nodes in the current route that go away from the destination
-		
-			// if valid route found
-			bool found;
-		} ;
-
 		// final route info
 		// only holds important information for route navigation
 		struct TRouteInfo {
@@ -255,10 +240,6 @@ class CPath : public CCvedItem {
 			double length; // length of segment or distance along lane in feet for the last segment
 		} ;
 
-		bool GetRouteChildren(int roadIdx, cvELnDir dir, CRoadPos& end, int height, TRouteNode* parent, int maxAway = -1) ;
-		void GetAllNodesAtLevel(TRouteNode* parent, int level, std::vector<TRouteNode*>& out) ;
-		void DiscardFarNodes(std::vector<TRouteNode*>& nodes, int numToKeep) ;
-
 	private:
 		void			AssertValid() const;
 
@@ -269,6 +250,26 @@ class CPath : public CCvedItem {
 									int& start
 									) const;
 		void			RemoveAnyExtraCorridors();
+		bool			FindCursor( CPathCursor& ) const;
+		ETravelCode		Advance( 
+							double, 
+							cTPathIterator&, 
+							CRoadPos&, 
+							bool, 
+							int& 
+							) const;
+		ETravelCode		Retreat( 
+							double, 
+							cTPathIterator&, 
+							CRoadPos&, 
+							bool, 
+							int& 
+							) const;
+		void			GetCrdrsIntoLane( 
+							const CIntrsctn&, 
+							const CLane&, 
+							vector<CCrdr>& 
+							) const;
 
 		// Member data
 		CFastDeque<CPathPoint> m_points;
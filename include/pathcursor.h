@@ -0,0 +1,98 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version: 		$Id: pathcursor.h,v 1.1 $
+//
+// Author(s):
+// Date:
+//
+// Description:	The definition of the CPathCursor class, a position that
+// 	travels along a CPath.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PATH_CURSOR_H
+#define __PATH_CURSOR_H	// {secret}
+
+#include "cvedpub.h"
+
+namespace CVED {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:
+// 	This class holds a road position on a CPath together with the path
+// 	point that it lies on.  It is placed with CPath::SetCursor and moved
+// 	with CPath::Travel and CPath::TravelBack, which resume from the path
+// 	point of the cursor instead of searching the path for the starting
+// 	position and move the road position in place instead of copying it.
+// 	Code that looks ahead along a path many times per frame should keep
+// 	a cursor per object rather than calling CPath::GetRoadPos.
+//
+//////////////////////////////////////////////////////////////////////////////
+class CPathCursor {
+
+	friend class CPath;
+
+	public:
+		CPathCursor();
+
+		bool			IsValid() const;
+		const CRoadPos&	GetRoadPos() const;
+		int				GetPathPointIdx() const;
+
+	private:
+		int				m_pathPoint;	// path point holding m_roadPos,
+										//	or -1 if not placed
+		CRoadPos		m_roadPos;		// current position
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Default constructor; the cursor is not placed on a path.
+//
+//////////////////////////////////////////////////////////////////////////////
+inline
+CPathCursor::CPathCursor()
+	: m_pathPoint( -1 )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Indicates whether the cursor has been placed on a path.
+//
+//////////////////////////////////////////////////////////////////////////////
+inline bool
+CPathCursor::IsValid() const
+{
+	return m_pathPoint >= 0 && m_roadPos.IsValid();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns the current road position of the cursor.
+//
+//////////////////////////////////////////////////////////////////////////////
+inline const CRoadPos&
+CPathCursor::GetRoadPos() const
+{
+	return m_roadPos;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns the index of the path point the cursor lies on.
+//
+//////////////////////////////////////////////////////////////////////////////
+inline int
+CPathCursor::GetPathPointIdx() const
+{
+	return m_pathPoint;
+}
+
+} // namespace CVED
+
+#endif // __PATH_CURSOR_H
@@ -69,11 +69,24 @@ class CPathNetwork : public CCvedItem {
 		friend ostream&	operator<<(ostream&, const CPathNetwork&);
 
 	private:
+		// The roads and intersections on the path built by
+		// RecursiveTowards, kept alongside the path so that checking
+		// for a loop is a bit test instead of a scan of the path.
+		// Entries are appended to onPath in the order they are set so
+		// that the path can be reverted to an earlier copy.
+		typedef struct TOnPath {
+			vector<bool>	isOnPath;	// roads first, then intersections
+			vector<int>		onPath;		// indexes set in isOnPath
+			int				numRoads;
+		} TOnPath;
+
 		// Private helper functions
 		bool RecursiveTowards(int srcIsec, int dstRoad,
-							  CPath&, vector<CPath>&) const;
-		static bool AlreadyContains(const CPath&, const CIntrsctn&);
-		static bool AlreadyContains(const CPath&, const CRoad&);
+							  CPath&, vector<CPath>&, TOnPath&) const;
+		static void AddToOnPath(const CPath&, int numPrepended, TOnPath&);
+		static void RevertOnPath(int size, TOnPath&);
+		static bool AlreadyContains(const TOnPath&, const CIntrsctn&);
+		static bool AlreadyContains(const TOnPath&, const CRoad&);
 
 		// Private data
 		double			m_covered;
@@ -45,7 +45,9 @@ public:
 	// Common constructors, destructor, anad assignment op
 	CRoadPos();
 	CRoadPos(const CRoadPos&);
+	CRoadPos(CRoadPos&&) noexcept;
 	CRoadPos& operator=(const CRoadPos&);
+	CRoadPos& operator=(CRoadPos&&) noexcept;
 	virtual ~CRoadPos();
 	explicit CRoadPos(const CCved&);
 
@@ -277,7 +279,8 @@ protected:
 	void			AssertValid(void) const;
 	int				Search(
 							double dist, 
-							const TCrdr* pCrdr=0
+							const TCrdr* pCrdr=0,
+							int cursor=-1
 							) const;
 	void			GetRoadSegments(
 							vector<TSegment>&,
@@ -312,6 +315,7 @@ protected:
 							const double cHeightThresh = cROAD_POS_EPS
 							);
 	double			ComputerCrdrOffset(int id=-1, const CPath *cpPath = NULL,int* pCorrUsed = NULL) const;
+	int				FindNextHldOfsCrdr(int lookahead, double& dist) const;
 
 	//bool GetRouteChildren(int roadIdx, cvELnDir dir, CRoadPos& end, int height, TRouteNode* parent, int maxAway = -1) ;
 	//void GetAllNodesAtLevel(TRouteNode* parent, int level, std::vector<TRouteNode*>& out) ;
@@ -336,9 +340,24 @@ private:
 		double			ofs;		// Offset from center of corridor.
 		TCntrlPntIdx	cntrlPntIdx;// Index of the crdr control point
 	} TCdo;
+
+	// A position usually overlaps only a few corridors, so that many
+	// are stored inside the CRoadPos and copying it does not allocate
+	enum { cNUM_INLINE_CDO = 4 };
+	typedef CSmallVec<TCdo, cNUM_INLINE_CDO> TCdoVec;
 	
 	TIntrsctn*		m_pIntrsctn;	// Pointer to the intrsctn structure
-	vector<TCdo>	m_cdo;			// Vector of corridor-dist-offsets.
+	TCdoVec			m_cdo;			// Vector of corridor-dist-offsets.
+
+	// Buffers reused by SetXYZ so that a search does not allocate
+	typedef struct TSearchScratch {
+		vector<TSegment>	segments;		// segments to search
+		vector<int>			quadTreeIds;	// road pieces, intersections
+		vector<int>			cntrlPnts;		// corridor control points
+		TCdoVec				cdo;			// previous corridor positions
+	} TSearchScratch;
+
+	static TSearchScratch&	GetSearchScratch(void);
 
 #define cSEARCH_DISTANCE 20.0f
 									// Distance along road/corridor to 
@@ -422,6 +441,26 @@ CRoadPos::CRoadPos(const CRoadPos &cCopy)
 {
 	*this = cCopy;
 }
+
+//////////////////////////////////////////////////////////////////
+//
+// Description: move constructor
+//
+// Remarks:
+// The corridor list is taken over from the parameter, which is left
+// without corridors.
+//
+// Arguments:
+//  move - the instance whose contents are moved to the current one
+//
+//////////////////////////////////////////////////////////////////////
+inline
+CRoadPos::CRoadPos(CRoadPos &&move) noexcept
+	:
+	CCvedItem(move)
+{
+	*this = static_cast<CRoadPos&&>(move);
+}
 		
 //////////////////////////////////////////////////////////////////
 //
@@ -0,0 +1,163 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version: 		$Id: routegraph.h,v 1.1 $
+//
+// Author(s):
+// Date:
+//
+// Description:	The definition of the CRouteGraph class, the road graph
+// 	searched by CPath::CalculateRoute.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __ROUTE_GRAPH_H
+#define __ROUTE_GRAPH_H
+
+#include "cvedpub.h"
+#include <mutex>
+
+struct cvTRouteHierNode;
+struct cvTRouteHierEdge;
+
+namespace CVED {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:
+// 	This class represents the road network as a directed graph for route
+// 	planning.  Each node of the graph is a road traveled in one direction
+// 	and each edge is a driving corridor that leads from the end of one road
+// 	to the beginning of another.  The length of an edge is the linear
+// 	length of its source road plus the length of the corridor.
+//
+// 	The graph is built by CCved when the LRI file is loaded and is stored
+// 	in compressed form: the edges leaving a node are adjacent in a single
+// 	array, so a route search does not construct CRoad or CIntrsctn
+// 	objects.  When the LRI file was compiled with a route hierarchy (the
+// 	-routes option of lricc), shortest routes without a limit on the
+// 	number of corridors are found by searching the hierarchy instead.
+//
+// 	Shortest routes are otherwise served from a cache of reverse shortest
+// 	route trees, one per destination road and direction.  Building a
+// 	tree takes a single backward search, after which the route from any
+// 	road to that destination is read off the tree; vehicles sent to the
+// 	same exit roads therefore share the cost of the search.
+//
+// 	The queries may be made from several threads at the same time; the
+// 	route tree cache is guarded by a lock.  The functions that build the
+// 	graph must not run concurrently with queries.
+//
+//////////////////////////////////////////////////////////////////////////////
+class CRouteGraph {
+
+	public:
+		// a corridor leading from one road to another
+		struct TEdge {
+			int			srcRoad;	// road the corridor starts from
+			cvELnDir	srcDir;		// direction of travel on srcRoad
+			int			crdrId;		// id of the corridor, relative to
+									//	its intersection
+			int			dstRoad;	// road the corridor leads to
+			cvELnDir	dstDir;		// direction of travel on dstRoad
+			double		length;		// length of srcRoad plus the corridor
+		};
+
+		CRouteGraph();
+
+		// Building the graph
+		void		Clear();
+		void		SetNumRoads( int );
+		void		SetRoadEnds(
+						int roadId,
+						double firstX, double firstY,
+						double lastX, double lastY
+						);
+		void		AddEdge( const TEdge& );
+		void		Finalize();
+		void		SetHierarchy(
+						const cvTRouteHierNode* pNodes,
+						int numNodes,
+						const cvTRouteHierEdge* pEdges
+						);
+
+		// Queries
+		bool		IsEmpty() const;
+		bool		HasHierarchy() const;
+		void		ClearRouteCache();
+		bool		FindRoute(
+						int srcRoad,
+						cvELnDir srcDir,
+						int dstRoad,
+						cvELnDir dstDir,
+						bool shortest,
+						int maxSteps,
+						vector<TEdge>& route
+						) const;
+		bool		FindShortestRoute(
+						int srcRoad,
+						cvELnDir srcDir,
+						int dstRoad,
+						cvELnDir dstDir,
+						vector<TEdge>& route
+						) const;
+
+	private:
+		static int	GetNode( int roadId, cvELnDir dir );
+		bool		FindShortestRoute(
+						int srcNode, int dstNode, int maxSteps,
+						vector<int>& edges
+						) const;
+		bool		FindFewestStepsRoute(
+						int srcNode, int dstNode, int maxSteps,
+						vector<int>& edges
+						) const;
+		bool		FindHierarchyRoute(
+						int srcNode, int dstNode,
+						vector<TEdge>& route
+						) const;
+		const cvTRouteHierEdge* FindHierarchyEdge( int from, int to ) const;
+		bool		FindCachedRoute(
+						int srcNode, int dstNode,
+						vector<TEdge>& route
+						) const;
+
+		// shortest routes from every node to one destination
+		struct TRouteTree {
+			vector<double>	dist;		// length of the route to the
+										//	destination, from each node
+			vector<int>		nextEdge;	// first edge of that route
+		};
+		typedef shared_ptr<const TRouteTree> TRouteTreePtr;
+		TRouteTreePtr GetRouteTree( int dstNode ) const;
+		bool		HasRouteTree( int dstNode ) const;
+
+		// Private data
+		vector<TEdge>	m_edges;		// sorted by source node
+		vector<int>		m_firstEdge;	// first edge of each node, with
+										//	an extra entry at the end
+		vector<int>		m_inEdges;		// edge indexes sorted by target
+		vector<int>		m_firstInEdge;	// first entry of m_inEdges for
+										//	each node, plus one at the end
+		vector<double>	m_entryX;		// point at which each node is
+		vector<double>	m_entryY;		//	entered, for the heuristic
+
+		// route hierarchy precomputed by the lri compiler, if any; these
+		// point into the memory block of CCved
+		const cvTRouteHierNode*	m_pHierNodes;
+		int						m_numHierNodes;
+		const cvTRouteHierEdge*	m_pHierEdges;
+
+		// shortest route trees built so far, keyed by destination node,
+		// and the order in which they were built; a tree stays valid for
+		// the callers holding it after it is discarded from the cache
+		mutable unordered_map<int, TRouteTreePtr>	m_routeTrees;
+		mutable deque<int>							m_routeTreeOrder;
+		mutable mutex								m_routeTreeLock;
+};
+
+} // namespace CVED
+
+#endif // __ROUTE_GRAPH_H
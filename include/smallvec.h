@@ -0,0 +1,195 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version: 		$Id: smallvec.h,v 1.1 $
+//
+// Author(s):
+// Date:
+//
+// Description:	The definition of the CSmallVec template, a vector that
+// 	stores its first few elements inside the object.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SMALL_VEC_H
+#define __SMALL_VEC_H	// {secret}
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <type_traits>
+
+namespace CVED {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:
+// 	This class is a vector of up to N elements that needs no heap memory.
+// 	Elements are stored inside the object until more than N of them are
+// 	added, at which point they are moved to the heap like a std::vector.
+// 	It supports the subset of the std::vector interface used by CVED,
+// 	and its iterators are plain pointers.
+//
+// 	Only trivially copyable types may be stored, so elements are copied
+// 	with memcpy and never constructed or destroyed.
+//
+//////////////////////////////////////////////////////////////////////////////
+template <class T, int N>
+class CSmallVec {
+
+	static_assert( std::is_trivially_copyable<T>::value,
+				"CSmallVec elements must be trivially copyable" );
+
+	public:
+		typedef T			value_type;
+		typedef T*			iterator;
+		typedef const T*	const_iterator;
+		typedef size_t		size_type;
+
+		CSmallVec() : m_pData( m_inline ), m_size( 0 ), m_capacity( N ) {}
+		CSmallVec( const CSmallVec& cCopy )
+			: m_pData( m_inline ), m_size( 0 ), m_capacity( N )
+		{
+			*this = cCopy;
+		}
+		CSmallVec( CSmallVec&& move ) noexcept
+			: m_pData( m_inline ), m_size( 0 ), m_capacity( N )
+		{
+			*this = static_cast<CSmallVec&&>( move );
+		}
+		~CSmallVec()
+		{
+			if( m_pData != m_inline )  free( m_pData );
+		}
+
+		CSmallVec& operator=( const CSmallVec& cRhs )
+		{
+			if( this != &cRhs )
+			{
+				m_size = 0;
+				reserve( cRhs.m_size );
+				if( cRhs.m_size > 0 )
+				{
+					memcpy( m_pData, cRhs.m_pData, cRhs.m_size * sizeof(T) );
+				}
+				m_size = cRhs.m_size;
+			}
+			return *this;
+		}
+		CSmallVec& operator=( CSmallVec&& rhs ) noexcept
+		{
+			if( this == &rhs )  return *this;
+
+			if( rhs.m_pData != rhs.m_inline )
+			{
+				// take over the heap block of the other vector
+				if( m_pData != m_inline )  free( m_pData );
+				m_pData     = rhs.m_pData;
+				m_size      = rhs.m_size;
+				m_capacity  = rhs.m_capacity;
+				rhs.m_pData    = rhs.m_inline;
+				rhs.m_capacity = N;
+			}
+			else
+			{
+				// the elements are inline, so they have to be copied,
+				// which cannot fail since they fit in this vector
+				if( rhs.m_size > 0 )
+				{
+					memcpy( m_pData, rhs.m_pData, rhs.m_size * sizeof(T) );
+				}
+				m_size = rhs.m_size;
+			}
+			rhs.m_size = 0;
+			return *this;
+		}
+
+		iterator		begin()			{ return m_pData; }
+		const_iterator	begin() const	{ return m_pData; }
+		iterator		end()			{ return m_pData + m_size; }
+		const_iterator	end() const		{ return m_pData + m_size; }
+
+		size_type		size() const	{ return m_size; }
+		size_type		capacity() const { return m_capacity; }
+		bool			empty() const	{ return m_size == 0; }
+
+		T&				operator[]( size_type i )		{ return m_pData[i]; }
+		const T&		operator[]( size_type i ) const	{ return m_pData[i]; }
+		T&				front()			{ return m_pData[0]; }
+		const T&		front() const	{ return m_pData[0]; }
+		T&				back()			{ return m_pData[m_size - 1]; }
+		const T&		back() const	{ return m_pData[m_size - 1]; }
+
+		void			clear()			{ m_size = 0; }
+
+		void			reserve( size_type n )
+		{
+			if( n <= m_capacity )  return;
+
+			size_type newCapacity = 2 * m_capacity;
+			if( newCapacity < n )  newCapacity = n;
+
+			T* pNew = static_cast<T*>( malloc( newCapacity * sizeof(T) ) );
+			if( pNew == 0 )  throw std::bad_alloc();
+			if( m_size > 0 )  memcpy( pNew, m_pData, m_size * sizeof(T) );
+			if( m_pData != m_inline )  free( m_pData );
+			m_pData    = pNew;
+			m_capacity = newCapacity;
+		}
+
+		void			push_back( const T& cElem )
+		{
+			if( m_size == m_capacity )
+			{
+				// the element may live in this vector
+				T copy = cElem;
+				reserve( m_size + 1 );
+				m_pData[m_size++] = copy;
+			}
+			else
+			{
+				m_pData[m_size++] = cElem;
+			}
+		}
+
+		void			pop_back()		{ m_size--; }
+
+		iterator		erase( iterator pos )
+		{
+			size_type i = pos - m_pData;
+			memmove( m_pData + i, m_pData + i + 1, (m_size - i - 1) * sizeof(T) );
+			m_size--;
+			return m_pData + i;
+		}
+
+		iterator		insert( iterator pos, const T& cElem )
+		{
+			size_type i = pos - m_pData;
+			T copy = cElem;
+			reserve( m_size + 1 );
+			memmove( m_pData + i + 1, m_pData + i, (m_size - i) * sizeof(T) );
+			m_pData[i] = copy;
+			m_size++;
+			return m_pData + i;
+		}
+
+		void			swap( CSmallVec& other )
+		{
+			CSmallVec tmp( static_cast<CSmallVec&&>( other ) );
+			other = static_cast<CSmallVec&&>( *this );
+			*this = static_cast<CSmallVec&&>( tmp );
+		}
+
+	private:
+		T*				m_pData;		// m_inline or a heap block
+		size_type		m_size;
+		size_type		m_capacity;
+		T				m_inline[N];
+};
+
+} // namespace CVED
+
+#endif // __SMALL_VEC_H
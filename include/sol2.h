@@ -23,6 +23,8 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <iostream>
 
 #include <TerrainGrid.h>
 #include <DynaParams.h>
@@ -119,6 +121,8 @@ public:
 	int					GetSirenSoundID()	const			{return m_SirenSoundID;}
 
 	virtual bool        Parse(ifstream& in);
+	virtual void        Save(ostream& out) const;
+	virtual bool        Load(istream& in);
 private:
 	int                 m_id;
 	double              m_length;
@@ -206,12 +210,15 @@ public:
 	int                 GetIsCabType() const            {return m_isCabType;}
 	double				GetLatAccelLimit() const	    {return m_lateralAccelLimitInMs2;}
 
+	virtual void        Save(ostream& out) const;
+	virtual bool        Load(istream& in);
 private:
 	int                 m_type;
 	vector<CSolColor>   m_colors;
 	vector<pair<int,float>>	m_axles;
 	vector<CSpecialOption> m_specialOptions;
 	CDynaParams         m_dynaParams;
+	string              m_dynaParamsText; //<text m_dynaParams was built from
 	int                 m_hornSoundId;
 	int                 m_hornSoundIntensity;
 	int                 m_collisionVehSoundIntensity;
@@ -250,6 +257,8 @@ public:
 	CSolObjWalker(int id) : CSolObj(id) { m_categoryName = "Walker"; m_animationSpeed = -1.0f; }
 	double GetAnimationSpeed() {return m_animationSpeed;}
 	virtual bool              Parse(ifstream& in);
+	virtual void              Save(ostream& out) const;
+	virtual bool              Load(istream& in);
 protected:
 	double	m_animationSpeed; //< Speed the base speed for the key-frame animation
 	// TBD
@@ -297,13 +306,18 @@ public:
 	int                       GetSurfaceObjectSoundId() const { return m_surfaceObjectSoundId; }
 
 	virtual bool              Parse(ifstream& in);
+	virtual void              Save(ostream& out) const;
+	virtual bool              Load(istream& in);
 private:
 	bool                      m_elevIsDelta;
 	int                       m_surfaceObjectSoundId;
 	CTerrainGrid<Post>        m_map;
+	string                    m_mapText;     //<inline map, if any
+	string                    m_mapFileName; //<map file, if any
 protected:
 	bool                      ParseMap(ifstream& in);
     bool                      ParseMapFile(ifstream& in);
+	bool                      LoadMapFile(const string& fileName);
 };
 
 
@@ -334,6 +348,8 @@ public:
 	
 	const vector<CCompositeComponent>&     GetReferences() const { return m_references; }
 	virtual bool              Parse(ifstream& in);
+	virtual void              Save(ostream& out) const;
+	virtual bool              Load(istream& in);
 private:
 	vector<CCompositeComponent> m_references;
 };
@@ -353,6 +369,12 @@ private:
 ///	   The sol2 files are to be located in the dir spec'ed by the env var
 /// <b>NADSSDC_SCN</b>. A log of all error critical or not are return by
 ///  GetParseLog.
+///
+///\remark
+///    After a successful parse the objects are saved in binary form to
+/// sol2.bin in the same directory, tagged with a checksum of the contents
+/// of the sol2 files. Later calls to Init load the binary file instead of
+/// parsing the text, as long as the checksum still matches.
 /////////////////////////////////////////////////////////////////////////////
 class CSol {
 public:
@@ -392,10 +414,13 @@ private:
 	//vector<CSolObj*>    m_objs;
 	map<int,CSolObj*>	m_objs;
 	string              m_checksum;
-	map<string, int>    m_nameToId;
+	unordered_map<string, CSolObj*> m_nameToObj;
 	int					m_objCnt;
 
 	bool				ParseHeader(ifstream& in);
+	bool				LoadCache(const string& fileName);
+	void				SaveCache(const string& fileName) const;
+	void				AddObj(CSolObj* pObj, const string& objType);
 	string				m_lastError;
 	string              m_parseLog;
 	bool                m_hasParseError; //<AUX sol2 files are considered "non-critical"
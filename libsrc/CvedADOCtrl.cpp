@@ -24,10 +24,12 @@ void CCvedADOCtrl::ExecuteDynamicModels(void)
 	TObjectPoolIdx id;
 	TObj*          pO;
 	int            count = 0; // optimization
-	TObjectPoolIdx attachedObjIds[cNUM_DYN_OBJS]; // list of objects that are attached to others
+	vector<TObjectPoolIdx>& attachedObjIds = m_attachedObjIds;
+	                                              // list of objects that are attached to others
 	                                              // they need to be processed after their parents
 	                                              // are processed.
-	TObjectPoolIdx freeMotionObjIds[cNUM_DYN_OBJS]; // list of objects in free motion. The main
+	vector<TObjectPoolIdx>& freeMotionObjIds = m_freeMotionObjIds;
+	                                                // list of objects in free motion. The main
 	                                                // loop will create the ode objects for them
 	                                                // if they are newly transitioned to free motion
 	                                                // mode, while the second loop processes them
@@ -62,7 +64,7 @@ void CCvedADOCtrl::ExecuteDynamicModels(void)
 	}
 	pO = BindObj( id );
 
-	while( id < cNUM_DYN_OBJS )
+	while( id < (TObjectPoolIdx) m_numDynObjs )
 	{
 		bool executeDynaModel = (
 					(
@@ -324,8 +326,7 @@ void CCvedADOCtrl::DistriTeleportPDO(CAvatarObj* obj, const CPoint3D* pos, const
 		, pos->m_x, pos->m_y, pos->m_z
 		, tan->m_i, tan->m_j, tan->m_k,  t_prime.m_i, t_prime.m_j, t_prime.m_k);
 	LockObjectPool();
-	TObj *pO = BindObj(obj->GetId());
-	pO->phase = eTELP;
+	SetDynObjPhase( obj->GetId(), eTELP );
 	UnlockObjectPool();
 }
 
@@ -349,12 +350,12 @@ void CCvedADOCtrl::Maintainer(void)
 	// implement the object phase transition diagram
 	LockObjectPool();
 	std::list<Teleport> lstTeleports;
-	for (i=0, pO = BindObj(0); i<cNUM_DYN_OBJS; i++, pO++) {
+	for (i=0, pO = BindObj(0); i<m_numDynObjs; i++, pO++) {
 		if ( pO->phase == eBORN ) {
 			if ( m_debug > 2 ) {
 				gout << "Object " << i << " from Born->Alive " << endl;
 			}
-			pO->phase = eALIVE;
+			SetDynObjPhase( i, eALIVE );
 			if (eCV_VEHICLE == pO->type) //an ado object has state transfered from eBORN->eALIVE
 			{
 				const CDynObj* pVehicle = BindObjIdToClass(i);
@@ -372,13 +373,13 @@ void CCvedADOCtrl::Maintainer(void)
 			if ( m_debug > 2 ) {
 				gout << "Object " << i << " from Dying->Dead " << endl;
 			}
-			pO->phase = eDEAD;
+			SetDynObjPhase( i, eDEAD );
 			m_pHdr->dynObjectCount--;
 
 		}
 		else if ( pO->phase == eTELP )
 		{
-			pO->phase = eALIVE;
+			SetDynObjPhase( i, eALIVE );
 			assert(eCV_AVATAR == pO->type);
 			CAvatarObj* avatar = static_cast<CAvatarObj*>(BindObjIdToClass2(i));
 			Teleport tel = {
@@ -394,7 +395,7 @@ void CCvedADOCtrl::Maintainer(void)
 	//
 	// Copy dynamic object state between buffers.
 	//
-	for( i = 0, pO = BindObj( 0 ); i < cNUM_DYN_OBJS; i++, pO++ )
+	for( i = 0, pO = BindObj( 0 ); i < m_numDynObjs; i++, pO++ )
 	{
 		if( pO->phase == eALIVE )
 		{
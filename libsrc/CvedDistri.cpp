@@ -334,7 +334,7 @@ void CCvedDistri::PegPDOs()
 
 	cvTObj  *pO = BindObj(0);
 	int i = 0;
-	for (; i<cNUM_DYN_OBJS; i++, pO++) {
+	for (; i<m_numDynObjs; i++, pO++) {
 		if ( maskVeh.Has(pO->type) ) id_vehi.push_back(i);
 		if ( maskPed.Has(pO->type) ) id_pdos.push_back(i);
 	}
@@ -376,19 +376,19 @@ void CCvedDistri::Maintainer(void)
 
 	// implement the object phase transition diagram
 	LockObjectPool();
-	for (i=0, pO = BindObj(0); i<cNUM_DYN_OBJS; i++, pO++) {
+	for (i=0, pO = BindObj(0); i<m_numDynObjs; i++, pO++) {
 		if ( pO->phase == eBORN ) {
 			if ( m_debug > 2 ) {
 				gout << "Object " << i << " from Born->Alive " << endl;
 			}
-			pO->phase = eALIVE;
+			SetDynObjPhase( i, eALIVE );
 		}
 		else
 		if ( pO->phase == eDYING ) {
 			if ( m_debug > 2 ) {
 				gout << "Object " << i << " from Dying->Dead " << endl;
 			}
-			pO->phase = eDEAD;
+			SetDynObjPhase( i, eDEAD );
 			m_pHdr->dynObjectCount--;
 		}
 	}
@@ -396,7 +396,7 @@ void CCvedDistri::Maintainer(void)
 	//
 	// Copy dynamic object state between buffers.
 	//
-	for( i = 0, pO = BindObj( 0 ); i < cNUM_DYN_OBJS; i++, pO++ )
+	for( i = 0, pO = BindObj( 0 ); i < m_numDynObjs; i++, pO++ )
 	{
 		if( pO->phase == eALIVE )
 		{
@@ -574,7 +574,7 @@ CCvedDistri::CreateDynObj(
 			}
 			return 0;
 		}
-		pO->phase = eBORN;
+		SetDynObjPhase( objId, eBORN );
 	}
 	else if ( type == eCV_EXTERNAL_TRAILER ) {
 		objId = 1;
@@ -591,9 +591,14 @@ CCvedDistri::CreateDynObj(
 			}
 			return 0;
 		}
-		pO->phase = eBORN;
+		SetDynObjPhase( objId, eBORN );
 	}
 	else {
+		// the header may remember a slot beyond the configured
+		// number of dynamic objects
+		if ( m_pHdr->lastObjAlloc >= m_numDynObjs )  {
+			m_pHdr->lastObjAlloc = m_numDynObjs - 1;
+		}
 		objId = m_pHdr->lastObjAlloc;
 		do {
 			objId++;
@@ -601,7 +606,7 @@ CCvedDistri::CreateDynObj(
 				objId = cMAX_EXT_CNTRL_OBJS;
 			}
 			else
-			if ( objId == cNUM_DYN_OBJS )  {
+			if ( objId == m_numDynObjs )  {
 				objId = cMAX_EXT_CNTRL_OBJS;
 			}
 
@@ -616,7 +621,7 @@ CCvedDistri::CreateDynObj(
 			return 0;
 		}
 		m_pHdr->lastObjAlloc = objId;
-		pO->phase            = eBORN;
+		SetDynObjPhase( objId, eBORN );
 	}
 
 	UnlockObjectPool();
@@ -631,12 +636,10 @@ CCvedDistri::CreateDynObj(
 	//
 	pO->myId = objId;
 	pO->type = type;
+	m_dynObjType[objId] = type;
 	strncpy_s(pO->name, cName.c_str(), cOBJ_NAME_LEN-1);
 
-	pair<string, int> pairToInsert;
-	pairToInsert.first = cName;
-	pairToInsert.second = objId;
-	m_objNameToId.insert( pairToInsert );
+	AddObjName( cName, objId );
 
 	// set up the cAttributes; we simply copy whatever
 	// the user provided into the allocated slot.
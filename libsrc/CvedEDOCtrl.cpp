@@ -38,10 +38,12 @@ void CCvedEDOCtrl::ExecuteDynamicModels(void)
 	TObjectPoolIdx id;
 	TObj*          pO;
 	int            count = 0; // optimization
-	TObjectPoolIdx attachedObjIds[cNUM_DYN_OBJS]; // list of objects that are attached to others
+	vector<TObjectPoolIdx>& attachedObjIds = m_attachedObjIds;
+	                                              // list of objects that are attached to others
 	                                              // they need to be processed after their parents
 	                                              // are processed.
-	TObjectPoolIdx freeMotionObjIds[cNUM_DYN_OBJS]; // list of objects in free motion. The main
+	vector<TObjectPoolIdx>& freeMotionObjIds = m_freeMotionObjIds;
+	                                                // list of objects in free motion. The main
 	                                                // loop will create the ode objects for them
 	                                                // if they are newly transitioned to free motion
 	                                                // mode, while the second loop processes them
@@ -68,7 +70,7 @@ void CCvedEDOCtrl::ExecuteDynamicModels(void)
 	id = 0;
 	pO = BindObj( id );
 
-	while( id < cNUM_DYN_OBJS )
+	while( id < (TObjectPoolIdx) m_numDynObjs )
 	{
 		bool executeDynaModel = (
 					(
@@ -1,6 +1,12 @@
 #include "cvedpub.h"
 #include "cvedstrc.h"	// private CVED data structs
 #include "RoadTraveler.h"
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+
 using namespace CVED;
 using namespace std;
 
@@ -33,6 +39,20 @@ CVED::CRoadTraveler::~CRoadTraveler(void)
 {
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void CRoadTraveler::SetPos(const CVED::CRoadPos& pos)
+///
+/// \brief  Moves the traveler to a new position, so that it can be reused
+///         without reallocating its buffers.
+///
+/// \param          pos     The position.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+CVED::CRoadTraveler::SetPos(const CVED::CRoadPos& pos)
+{
+    m_pos = pos;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn bool CRoadTraveler::Travel(float& dist, std::vector<int>& objects)
 ///
@@ -49,16 +69,34 @@ CVED::CRoadTraveler::~CRoadTraveler(void)
 
 bool 
 CVED::CRoadTraveler::Travel(float& dist, std::vector<int>& objects, std::vector<float>& dists, int ignoreId){
-    if (!m_pos.IsValid())
+    return TravelFrom(m_pos, dist, objects, dists, ignoreId);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn bool CRoadTraveler::TravelFrom(CVED::CRoadPos& pos, float& dist, std::vector<int>& objects, std::vector<float>& dists, int ignoreId)
+///
+/// \brief  Travels from the given position, as Travel does from the position of the traveler.
+///
+/// \param [in]     pos     The position to start from.
+/// \param [in,out] dist    The distance.
+/// \param [out]    objects The objects.
+/// \param [out]    dists   The distances to the objects.
+/// \param          ignoreId The object to leave out.
+///
+/// \return True if it succeeds, false if it fails.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool
+CVED::CRoadTraveler::TravelFrom(CVED::CRoadPos& pos, float& dist, std::vector<int>& objects, std::vector<float>& dists, int ignoreId){
+    if (!pos.IsValid())
         return false;
     objects.clear();
     dists.clear();
     float cumulativeDist = 0;
-    return TravelPriv(dist,cumulativeDist, m_pos, objects,dists,ignoreId);
+    return TravelPriv(dist,cumulativeDist, pos, objects,dists,ignoreId);
 }
 bool
-FindDestCrdr(CVED::CLane& pos, CVED::CIntrsctn &intr, int &id){
-    TCrdrVec vec;
+FindDestCrdr(CVED::CLane& pos, CVED::CIntrsctn &intr, int &id, TCrdrVec& vec){
+    vec.clear();
     intr.GetCrdrsStartingFrom(pos, vec);
     if (vec.size() == 0) return false;
     for (auto itr = vec.begin(); itr != vec.end(); ++itr) {
@@ -72,7 +110,7 @@ FindDestCrdr(CVED::CLane& pos, CVED::CIntrsctn &intr, int &id){
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn bool FindSrcCrdr(CVED::CLane& pos, CVED::CIntrsctn &intr, int &id)
+/// \fn bool FindSrcCrdr(CVED::CLane& pos, CVED::CIntrsctn &intr, int &id, TCrdrVec& vec)
 ///
 /// \brief  Searches for straight source crdr.
 ///
@@ -82,13 +120,14 @@ FindDestCrdr(CVED::CLane& pos, CVED::CIntrsctn &intr, int &id){
 /// \param [in] pos     The position.
 /// \param [in] intr    The intersection.
 /// \param [out] id     Relative Crdr ID.
+/// \param vec          Buffer for the corridors leading to the lane.
 ///
 /// \return True if it succeeds, false if it fails.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool
-FindSrcCrdr(CVED::CLane& pos, CVED::CIntrsctn &intr, int &id){
-    TCrdrVec vec;
+FindSrcCrdr(CVED::CLane& pos, CVED::CIntrsctn &intr, int &id, TCrdrVec& vec){
+    vec.clear();
     intr.GetCrdrsLeadingTo(pos, vec);
     if (vec.size() == 0) return false;
     for (auto itr = vec.begin(); itr != vec.end(); ++itr) {
@@ -121,7 +160,7 @@ bool
 CVED::CRoadTraveler::TravelPrivRoad(float& dist,float& cumulativeDist, CVED::CRoadPos& pos, std::vector<int>& objects, std::vector<float>& dists, int ignoreId) {
     CVED::CLane lane = pos.GetLane();
     int id = lane.GetId();
-    vector<CCved::TObjWithDist> res;
+    vector<CCved::TObjWithDist>& res = m_objs;
     float targetDist = dist;
     float deltaD = 0;
     m_cCved.GetAllDynObjsOnLane(lane, res, eCV_VEHICLE);
@@ -178,10 +217,10 @@ CVED::CRoadTraveler::TravelPrivRoad(float& dist,float& cumulativeDist, CVED::CRo
     int crdrId = -1;
     if (m_path.IsValid()){
         if (!m_path.GetCrdrFromIntrscn(intr.GetId(), crdrId, &pos, lane.GetId())) {
-            FindDestCrdr(lane,intr, crdrId);
+            FindDestCrdr(lane,intr, crdrId, m_crdrs);
         }
     }else{
-        FindDestCrdr(lane, intr, crdrId);
+        FindDestCrdr(lane, intr, crdrId, m_crdrs);
     }
     if (crdrId < 0)
         return false;
@@ -236,7 +275,8 @@ bool
 CVED::CRoadTraveler::TravelPrivCrdr(float& dist,float& cumulativeDist, CVED::CRoadPos& pos, std::vector<int>& objects, std::vector<float>& dists, int ignoreId) {
     CVED::CCrdr crdr = pos.GetCorridor();
     int id = crdr.GetId();
-    vector<CCved::TObjWithDist> res;
+    vector<CCved::TObjWithDist>& res = m_objs;
+    res.clear();
     m_cCved.GetAllDynObjsOnCrdr(crdr.GetIntrsctnId(),crdr.GetRelativeId(), res, eCV_VEHICLE);
     double myDist = pos.GetDistance();
     float initDist = dist;
@@ -284,7 +324,7 @@ CVED::CRoadTraveler::TravelPrivRoadNeg(float& dist,float& cumulativeDist, CVED::
     CVED::CLane lane = pos.GetLane();
 	double roadDist = lane.GetRoad().GetCubicLength();
     int id = lane.GetId();
-    vector<CCved::TObjWithDist> res;
+    vector<CCved::TObjWithDist>& res = m_objs;
     m_cCved.GetAllDynObjsOnLane(lane, res, eCV_VEHICLE);
     float sign = 1.0;
     auto dir = lane.GetDirection();
@@ -336,11 +376,11 @@ CVED::CRoadTraveler::TravelPrivRoadNeg(float& dist,float& cumulativeDist, CVED::
     int crdrId = -1;
     if (m_path.IsValid()) {
         if (!m_path.GetCrdrFromIntrscn(intr.GetId(), crdrId, &pos, lane.GetId())) {
-            FindSrcCrdr(lane, intr, crdrId);
+            FindSrcCrdr(lane, intr, crdrId, m_crdrs);
         }
     }
     else {
-        FindSrcCrdr(lane, intr, crdrId);
+        FindSrcCrdr(lane, intr, crdrId, m_crdrs);
     }
     if (crdrId < 0)
         return false;
@@ -395,7 +435,8 @@ bool
 CVED::CRoadTraveler::TravelPrivCrdrNeg(float& dist,float& cumulativeDist, CVED::CRoadPos& pos, std::vector<int>& objects, std::vector<float>& dists, int ignoreId) {
     CVED::CCrdr crdr = pos.GetCorridor();
     int id = crdr.GetId();
-    vector<CCved::TObjWithDist> res;
+    vector<CCved::TObjWithDist>& res = m_objs;
+    res.clear();
     m_cCved.GetAllDynObjsOnCrdr(crdr.GetIntrsctnId(), crdr.GetRelativeId(), res, eCV_VEHICLE);
     double myDist = pos.GetDistance();
     float distMin = myDist - dist;
@@ -455,24 +496,52 @@ CVED::CRoadTraveler::TravelPriv(float& dist,float& cumulativeDist, CVED::CRoadPo
 TTrafficCloudData  CVED::CRoadTraveler::GetTrafficCloudInformation(
     float dist, int id) {
     TTrafficCloudData res;
+    GetTrafficCloudInformation(dist, id, res);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void CRoadTraveler::GetTrafficCloudInformation(float dist, int id, TTrafficCloudData& res)
+///
+/// \brief  Gets the vehicles ahead and behind on the lane of the traveler and on the lanes to
+///         its left and right.
+///
+/// The lists in res are cleared first, so a TTrafficCloudData kept between calls does not
+/// need to reallocate them.
+///
+/// \param          dist    The distance to look ahead and behind.
+/// \param          id      The vehicle to leave out, normally the one at the position.
+/// \param [out]    res     The traffic cloud.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+CVED::CRoadTraveler::GetTrafficCloudInformation(
+    float dist, int id, TTrafficCloudData& res) {
+    res.ids.sameForward.clear();
+    res.ids.sameBackward.clear();
+    res.ids.leftForward.clear();
+    res.ids.leftBackward.clear();
+    res.ids.rightForward.clear();
+    res.ids.rightBackward.clear();
+    res.dist.sameForward.clear();
+    res.dist.sameBackward.clear();
+    res.dist.leftForward.clear();
+    res.dist.leftBackward.clear();
+    res.dist.rightForward.clear();
+    res.dist.rightBackward.clear();
     if (!m_pos.IsValid())
-        return res;
+        return;
     
 
     float fdist = dist;
-    CRoadPos rightPos,leftPos,samePos;
+    CRoadPos rightPos,leftPos;
     /////////////////////////////////////
     //Same Lane
     ///////////////////////////////////// 
     {
-        samePos = m_pos;
-        CRoadTraveler rt(samePos, m_cCved, m_path);
         float negDist = -fdist;
-        rt.Travel(negDist, res.ids.sameBackward,res.dist.sameBackward,id);
+        TravelFrom(m_pos, negDist, res.ids.sameBackward,res.dist.sameBackward,id);
         fdist = dist;
-        CRoadTraveler rtf(samePos, m_cCved, m_path);
-        
-        rtf.Travel(fdist, res.ids.sameForward,res.dist.sameForward,id);
+        TravelFrom(m_pos, fdist, res.ids.sameForward,res.dist.sameForward,id);
     }
     /////////////////////////////////////
     //Right Lane
@@ -480,16 +549,18 @@ TTrafficCloudData  CVED::CRoadTraveler::GetTrafficCloudInformation(
     rightPos = m_pos;
     if (rightPos.IsRoad()){
         if (rightPos.ChangeLaneRight()){
-            CRoadTraveler rt(rightPos, m_cCved, m_path);
             fdist = -dist;
-            rt.Travel(fdist, res.ids.rightBackward, res.dist.rightBackward,id);
+            TravelFrom(rightPos, fdist, res.ids.rightBackward, res.dist.rightBackward,id);
             fdist = dist;
-            rt.Travel(fdist, res.ids.rightForward,res.dist.rightForward,id);
+            TravelFrom(rightPos, fdist, res.ids.rightForward,res.dist.rightForward,id);
         }
     } else {
         auto crdr = rightPos.GetCorridor();
         auto lane = crdr.GetSrcLn();
-        TCrdrVec srcCrds,destCrds;
+        TCrdrVec& srcCrds = m_srcCrdrs;
+        TCrdrVec& destCrds = m_destCrdrs;
+        srcCrds.clear();
+        destCrds.clear();
         if (lane.IsValid()){
             CRoadPos rp(lane.GetRoad(),lane);
             if (rp.ChangeLaneRight()){
@@ -524,31 +595,29 @@ TTrafficCloudData  CVED::CRoadTraveler::GetTrafficCloudInformation(
                 tdist = target.GetLength();
             }
             CRoadPos pos(target.GetIntrsctn(),target, tdist);
-            CRoadTraveler rt(pos, m_cCved, m_path);
             fdist = -dist;
             auto ownLaneBackward = crdr.GetSrcLn();
             auto targetBackward = target.GetSrcLn();
             if (ownLaneBackward.IsValid() && targetBackward.IsValid()) {
                 if (ownLaneBackward == targetBackward) {//if lanes are merging
                     float distBackward = -min(dist, float(target.GetLength()));
-                    rt.Travel(distBackward, res.ids.rightForward, res.dist.rightForward, id);
+                    TravelFrom(pos, distBackward, res.ids.rightForward, res.dist.rightForward, id);
                 }
                 else {
-                    rt.Travel(fdist, res.ids.rightBackward, res.dist.rightBackward, id);
+                    TravelFrom(pos, fdist, res.ids.rightBackward, res.dist.rightBackward, id);
                 }
             }
 
             fdist = dist;
             auto ownLaneForward = crdr.GetDstntnLn();
             auto targetForward = target.GetDstntnLn();
-            CRoadTraveler rtf(pos, m_cCved, m_path);
             if (ownLaneForward.IsValid() && targetForward.IsValid()) {
                 if (ownLaneForward == targetForward) {//if lanes are merging
                     float distForward = min(fdist, float(target.GetLength() - tdist));
-                    rtf.Travel(distForward, res.ids.rightForward, res.dist.rightForward, id);
+                    TravelFrom(pos, distForward, res.ids.rightForward, res.dist.rightForward, id);
                 }
                 else {
-                    rtf.Travel(fdist, res.ids.rightForward, res.dist.rightForward, id);
+                    TravelFrom(pos, fdist, res.ids.rightForward, res.dist.rightForward, id);
                 }
             }
         }
@@ -559,17 +628,18 @@ TTrafficCloudData  CVED::CRoadTraveler::GetTrafficCloudInformation(
     leftPos = m_pos;
     if (leftPos.IsRoad()) {
         if (leftPos.ChangeLaneLeft()) {
-            CRoadTraveler lt(leftPos, m_cCved, m_path);
             fdist = -dist;
-            lt.Travel(fdist, res.ids.leftBackward, res.dist.leftBackward,id);
-            CRoadTraveler ltf(leftPos, m_cCved, m_path);
-            ltf.Travel(fdist, res.ids.leftForward,res.dist.leftForward,id);
+            TravelFrom(leftPos, fdist, res.ids.leftBackward, res.dist.leftBackward,id);
+            TravelFrom(leftPos, fdist, res.ids.leftForward,res.dist.leftForward,id);
         }
     }
     else {
         auto crdr = leftPos.GetCorridor();
         auto lane = crdr.GetSrcLn();
-        TCrdrVec srcCrds, destCrds;
+        TCrdrVec& srcCrds = m_srcCrdrs;
+        TCrdrVec& destCrds = m_destCrdrs;
+        srcCrds.clear();
+        destCrds.clear();
         if (lane.IsValid()) {
             CRoadPos rp(lane.GetRoad(), lane);
             if (rp.ChangeLaneLeft()) {
@@ -604,20 +674,18 @@ TTrafficCloudData  CVED::CRoadTraveler::GetTrafficCloudInformation(
                 tdist = target.GetLength();
             }
             CRoadPos pos(target.GetIntrsctn(), target, tdist);
-            CRoadTraveler lt(pos, m_cCved, m_path);
             fdist = -dist;
             auto ownLaneBackward = crdr.GetSrcLn();
             auto targetBackward = target.GetSrcLn();
             if (ownLaneBackward.IsValid() && targetBackward.IsValid()) {
                 if (ownLaneBackward == targetBackward) {//if lanes are merging
                     float distBackward = -min(dist, float(target.GetLength()));
-                    lt.Travel(distBackward, res.ids.rightForward, res.dist.rightForward, id);
+                    TravelFrom(pos, distBackward, res.ids.rightForward, res.dist.rightForward, id);
                 }
                 else {
-                    lt.Travel(fdist, res.ids.leftBackward, res.dist.leftBackward, id);
+                    TravelFrom(pos, fdist, res.ids.leftBackward, res.dist.leftBackward, id);
                 }
             }
-            CRoadTraveler ltf(pos, m_cCved, m_path);
             fdist = dist;
 
             auto ownLaneForward = crdr.GetDstntnLn();
@@ -625,13 +693,91 @@ TTrafficCloudData  CVED::CRoadTraveler::GetTrafficCloudInformation(
             if (ownLaneForward.IsValid() && targetForward.IsValid()) {
                 if (ownLaneForward == targetForward) {//if lanes are merging
                     float distForward = min(fdist, float(target.GetLength() - tdist));
-                    ltf.Travel(distForward, res.ids.rightForward, res.dist.rightForward, id);
+                    TravelFrom(pos, distForward, res.ids.rightForward, res.dist.rightForward, id);
                 }
                 else {
-                    ltf.Travel(fdist, res.ids.leftForward, res.dist.leftForward, id);
+                    TravelFrom(pos, fdist, res.ids.leftForward, res.dist.leftForward, id);
                 }
             }
         }
     }
-    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void CRoadTraveler::GetTrafficCloudInformation(const CVED::CCved& cved, const std::vector<CVED::CRoadPos>& positions, const std::vector<int>& ids, float dist, std::vector<TTrafficCloudData>& res, int numThreads)
+///
+/// \brief  Gets the traffic clouds of many vehicles, splitting them among several threads.
+///
+/// Each thread uses a single traveler for all the vehicles it handles. The results are the
+/// same as those of calling GetTrafficCloudInformation for each position in turn, and the
+/// entries of res are reused, so keeping res between frames avoids reallocating its lists.
+/// CVED only is read, so this must not be called while the maintainer is running. If a
+/// query throws an exception, the first one is thrown again on the calling thread.
+///
+/// \param          cved        The cved.
+/// \param          positions   The positions of the vehicles.
+/// \param          ids         The ids of the vehicles, left out of their own clouds.
+/// \param          dist        The distance to look ahead and behind.
+/// \param [out]    res         The traffic cloud of each vehicle.
+/// \param          numThreads  The number of threads to use, including the calling thread;
+///                             0 uses one per processor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+CVED::CRoadTraveler::GetTrafficCloudInformation(
+    const CVED::CCved& cved,
+    const std::vector<CVED::CRoadPos>& positions,
+    const std::vector<int>& ids,
+    float dist,
+    std::vector<TTrafficCloudData>& res,
+    int numThreads) {
+    const int cChunk = 8;
+    int numVehicles = (int)min(positions.size(), ids.size());
+    res.resize(numVehicles);
+    if (numVehicles == 0)
+        return;
+
+    if (numThreads <= 0) {
+        numThreads = (int)thread::hardware_concurrency();
+        if (numThreads <= 0) numThreads = 1;
+    }
+    int maxThreads = (numVehicles + cChunk - 1) / cChunk;
+    if (numThreads > maxThreads) numThreads = maxThreads;
+
+    atomic<int> next(0);
+    atomic<bool> failed(false);
+    exception_ptr error;
+    mutex errorLock;
+
+    auto work = [&]() {
+        CRoadPos pos;
+        CRoadTraveler traveler(pos, cved);
+        while (!failed) {
+            int first = next.fetch_add(cChunk);
+            if (first >= numVehicles) break;
+            int last = min(first + cChunk, numVehicles);
+            try {
+                for (int i = first; i < last; i++) {
+                    traveler.SetPos(positions[i]);
+                    traveler.GetTrafficCloudInformation(dist, ids[i], res[i]);
+                }
+            }
+            catch (...) {
+                lock_guard<mutex> guard(errorLock);
+                if (!failed) error = current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    vector<thread> threads;
+    threads.reserve(numThreads - 1);
+    for (int i = 1; i < numThreads; i++) {
+        threads.push_back(thread(work));
+    }
+    work();
+    for (auto itr = threads.begin(); itr != threads.end(); ++itr) {
+        itr->join();
+    }
+
+    if (error) rethrow_exception(error);
 }
@@ -885,13 +885,13 @@ CCrdr::GetMrgDstFirst(vector<double>& dists) const
 	cvTCrdrMrgDst* pEntry = 
 				(reinterpret_cast<cvTCrdrMrgDst*>(pOfs)) + m_pCrdr->mrgDstIdx;
 
-	int numCrdrs = GetIntrsctn().GetNumCrdrs();
+	int numCrdrs = BindIntrsctn(m_pCrdr->intrsctnId)->numOfCrdrs;
 	//pEntry += (numCrdrs * GetRelativeId());
 	
-	dists.clear();
+	dists.resize(numCrdrs);
 	int i = 0;
 	for(; i<numCrdrs; i++){
-		dists.push_back(pEntry->firstDist);
+		dists[i] = pEntry->firstDist;
 		pEntry += 1;
 	}
 }
@@ -899,27 +899,22 @@ CCrdr::GetMrgDstFirst(vector<double>& dists) const
 void
 CCrdr::GetMrgDstFirst(double& dist, int& crdrId) const
 {
-	vector<double> dists;
-	GetMrgDstFirst(dists);
+	int numConflicts;
+	const TCrdrConflict* pConflict =
+				GetCrdrConflicts(m_pCrdr->myId, numConflicts);
 	dist = -1;
 	crdrId = -1;
 	bool first = false;
 
-	int size = (int) dists.size();
 	int i = 0;
-	for(; i<size; i++){
-		if (dists[i] < 0){
+	for(; i<numConflicts; i++, pConflict++){
+		if (pConflict->firstDist < 0){
 			continue;
 		}
-		if (!first){
-			dist = dists[i];
-            crdrId = i;
+		if (!first || pConflict->firstDist < dist){
+			dist = pConflict->firstDist;
+			crdrId = pConflict->crdrId;
 			first = true;
-			continue;
-		}
-		if (dists[i]<dist){
-			dist = dists[i];
-			crdrId = i;
 		}
 	}	
 }
@@ -942,25 +937,11 @@ CCrdr::GetMrgDstFirst(double& dist, int& crdrId) const
 double 
 CCrdr::GetFirstMrgDist( int crdrId ) const
 {
-	double mrgDist;
-	/*static*/ vector<double> dists;
-	dists.clear();
-	dists.reserve(15);
-	GetMrgDstFirst( dists );
-	bool found = false;
-	for( unsigned int i = 0; i < dists.size(); i++ )
-	{
-		if( i == crdrId )
-		{
-			found = true;
-			mrgDist = dists[i];
-			break;
-		}
-	}
-	if( !found )
+	const cvTCrdrMrgDst* pEntry = GetMrgDstEntry( crdrId );
+	if( pEntry == 0 )
 		return -1.0;
 	else
-		return mrgDist;
+		return pEntry->firstDist;
 
 }	// end of GetMrgDist
 
@@ -983,28 +964,45 @@ CCrdr::GetFirstMrgDist( int crdrId ) const
 double 
 CCrdr::GetLastMrgDist( int crdrId ) const
 {
-	double mrgDist;
-	vector<double> dists;
-	GetMrgDstLast( dists );
-	bool found = false;
-	for( unsigned int i = 0; i < dists.size(); i++ )
-	{
-		if( i == crdrId )
-		{
-			found = true;
-			mrgDist = dists[i];
-			break;
-		}
-	}
-	if( !found )
+	const cvTCrdrMrgDst* pEntry = GetMrgDstEntry( crdrId );
+	if( pEntry == 0 )
 		return -1.0;
 	else
-		return mrgDist;
+		return pEntry->lastDist;
 
 }	// end of GetMrgDist
 
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetMrgDstEntry 
+//  This function returns the entry of the merge distance matrix that
+//  describes where the current corridor meets another corridor.
+//
+// Remarks: 
+//
+// Arguments:
+//  crdrId - relative id of the other corridor
+//
+// Returns: A pointer to the entry, or 0 if crdrId is not the relative
+//  id of a corridor of the same intersection.
+//
+//////////////////////////////////////////////////////////////////////////////
+const cvTCrdrMrgDst*
+CCrdr::GetMrgDstEntry( int crdrId ) const
+{
+	int numCrdrs = BindIntrsctn(m_pCrdr->intrsctnId)->numOfCrdrs;
+	if( crdrId < 0 || crdrId >= numCrdrs )  return 0;
+
+	cvTHeader*  pH   = static_cast<cvTHeader*>  (GetInst());
+	char*       pOfs = static_cast<char*> (GetInst()) + pH->crdrMrgDstOfs;
+	return (reinterpret_cast<cvTCrdrMrgDst*>(pOfs)) + m_pCrdr->mrgDstIdx +
+				crdrId;
+}	// end of GetMrgDstEntry
+
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description: GetMrgDstLast 
@@ -1032,13 +1030,13 @@ CCrdr::GetMrgDstLast(vector<double>& dists) const
 	cvTCrdrMrgDst* pEntry = 
 				(reinterpret_cast<cvTCrdrMrgDst*>(pOfs)) + m_pCrdr->mrgDstIdx;
 
-	int numCrdrs = GetIntrsctn().GetNumCrdrs();
+	int numCrdrs = BindIntrsctn(m_pCrdr->intrsctnId)->numOfCrdrs;
 	//pEntry += (numCrdrs * GetRelativeId());
 	
-	dists.clear();
+	dists.resize(numCrdrs);
 	int i = 0;
 	for(; i<numCrdrs; i++){
-		dists.push_back(pEntry->lastDist);
+		dists[i] = pEntry->lastDist;
 		pEntry += 1;
 	}
 }
@@ -1046,29 +1044,22 @@ CCrdr::GetMrgDstLast(vector<double>& dists) const
 void
 CCrdr::GetMrgDstLast(double& dist, int& crdrId) const
 {
-	/*static*/ vector<double> dists;
-	dists.clear();
-	dists.reserve(15);
-	GetMrgDstLast(dists);
+	int numConflicts;
+	const TCrdrConflict* pConflict =
+				GetCrdrConflicts(m_pCrdr->myId, numConflicts);
 	dist = -1;
 	crdrId = -1;
 	bool first = false;
 
-	int size = (int) dists.size();
 	int i = 0;
-	for(; i<size; i++){
-		if (dists[i] < 0){
+	for(; i<numConflicts; i++, pConflict++){
+		if (pConflict->lastDist < 0){
 			continue;
 		}
-		if (!first){
-			dist = dists[i];
-            crdrId = i;
+		if (!first || pConflict->lastDist > dist){
+			dist = pConflict->lastDist;
+			crdrId = pConflict->crdrId;
 			first = true;
-			continue;
-		}
-		if (dists[i]>dist){
-			dist = dists[i];
-			crdrId = i;
 		}
 	}	
 }
@@ -1080,27 +1071,25 @@ CCrdr::GetMrgDstLast(double& dist, int& crdrId) const
 //	This function obtains all the corridors that intersect with the current
 //	corridor instance.
 //
-// Remarks: 
+// Remarks: The corridors are read from the conflict table that CCved
+//	builds from the merge distance matrix when the LRI file is loaded.
 //
 // Arguments:
 //	out - The output parameter that contains the desired intersecting corridors ids.
-//		Note that the vector index matches the corridor ids.
+//		The relative ids of the intersecting corridors are appended in
+//		increasing order.
 // 
 // Returns:	void
 //////////////////////////////////////////////////////////////////////////////
 void
 CCrdr::GetIntersectingCrdrs( vector<int>& out ) const
 {
-	/*static*/ vector<double> dists;
-	dists.clear();
-	dists.reserve(15);
-	this->GetMrgDstFirst( dists );
-	for( unsigned int i = 0; i < dists.size(); i++ )
+	int numConflicts;
+	const TCrdrConflict* pConflict =
+				GetCrdrConflicts( m_pCrdr->myId, numConflicts );
+	for( int i = 0; i < numConflicts; i++, pConflict++ )
 	{
-		if( dists[i] != -1 )
-		{
-			out.push_back( i );
-		}
+		out.push_back( pConflict->crdrId );
 	}
 }
 
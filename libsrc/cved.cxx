@@ -31,6 +31,25 @@ template int* std::copy_backward<int*,int*>(int*,int*,int*);
 #include <winhrt.h>
 #include <TCHAR.H>
 
+// the state of the vehicle dynamics, defined in vehicledynamics.cxx
+extern vector<cvTFourWheelVeh>	g_stateVector;
+extern vector<cvTVehLin>		g_vehLin;
+
+//
+// The state of the vehicle dynamics is shared by all the instances and
+// indexed by object identifier, so it only grows to cover the dynamic
+// object slots of each instance.
+//
+static void
+GrowVehDynState( int numDynObjs )
+{
+	if( (int) g_stateVector.size() < numDynObjs )
+	{
+		g_stateVector.resize( numDynObjs );
+		g_vehLin.resize( numDynObjs );
+	}
+}
+
 //
 // Debugging macros.
 //
@@ -90,7 +109,11 @@ CCved::CCved()
 	  m_state( eUNCONFIGURED ),
 	  m_haveFakeExternalDriver( true ),
 	  m_FirstTimeLightsNear(true),
-      m_currentExternalCntlId(1)
+      m_currentExternalCntlId(1),
+	  m_qryMemoEnabled( false ),
+	  m_qryMemoFrame( 0 ),
+	  m_qryMemoHits( 0 ),
+	  m_qryMemoMisses( 0 )
 {
 
 	m_terQryCalls = m_terQryRoadHits = m_terQryInterHits = 0;
@@ -100,12 +123,10 @@ CCved::CCved()
 	m_MUTEX_LightsNear = CreateMutex(NULL,0,"m_MUTEX_LightsNear");
 	ReleaseMutex(m_MUTEX_LightsNear);
 #endif
-	for( i = 0; i < cNUM_DYN_OBJS; i++ )
-	{
-		m_dynObjCache[i] = 0;
-	}
+	SizeDynObjArrays( cNUM_DYN_OBJS );
 	m_pSavedObjLoc = 0;
 	m_NullTerrQuery = false;
+	ResetChangeJournal();
 
 	if (m_sSol.IsInitialized()) return;
 
@@ -131,14 +152,14 @@ CCved::CCved()
 CCved::~CCved()
 {
 	int i;
-	for( i = 0; i < cNUM_DYN_OBJS; i++ )
+	for( i = 0; i < m_numDynObjs; i++ )
 	{
 		delete m_dynObjCache[i];
 	}
 
 	if( m_pSavedObjLoc != 0 )
 	{
-		for( i = 0; i < cNUM_DYN_OBJS; i++ )
+		for( i = 0; i < m_numDynObjs; i++ )
 		{
 		   delete[] m_pSavedObjLoc[i].pDynObjRefs;
 		}
@@ -198,20 +219,44 @@ CCved::~CCved()
 //   delta 	- how much time is simulated between invokations of the maintainer
 //   dynaMult - how many times the dynamic models will execute
 //            between invokations of the maintainer
+//   numDynObjs - (optional) how many dynamic objects can exist at the
+//            same time; it must be larger than cMAX_EXT_CNTRL_OBJS and
+//            cannot exceed cNUM_DYN_OBJS, the number of dynamic object
+//            slots in the LRI object pool
 //
 // Returns: The function returns true to indicate that the parameters are
 //   consistent and have been set, or false otherwise.  Invalid parameters
-//   include a negative time step or dynamics multiplier.  If the function
+//   include a negative time step or dynamics multiplier, and a number of
+//   dynamic objects that is out of range or that differs from the current
+//   one after the instance has been initialized.  If the function
 //   returns false, then it is considered unconfigured and cannot be
 //   initilialized.
 //
 //////////////////////////////////////////////////////////////////////////////
 bool
-CCved::Configure( CCved::ECvedMode mode, double delta, int dynaMult )
+CCved::Configure(
+			CCved::ECvedMode mode,
+			double delta,
+			int dynaMult,
+			int numDynObjs
+			)
 {
 	// standard error checking
 	if( delta <= 0.0 )  return false;
 	if( dynaMult < 1 )  return false;
+	if( numDynObjs <= cMAX_EXT_CNTRL_OBJS || numDynObjs > cNUM_DYN_OBJS )
+	{
+		fprintf(
+			stderr,
+			"CVED: Configure: number of dynamic objects %d not in (%d, %d]\n",
+			numDynObjs,
+			cMAX_EXT_CNTRL_OBJS,
+			cNUM_DYN_OBJS
+			);
+		fflush( stderr );
+		return false;
+	}
+	if( numDynObjs != m_numDynObjs && m_state == eACTIVE )  return false;
 	if( mode == eCV_MULTI_USER )
 	{
 		fprintf(
@@ -226,6 +271,8 @@ CCved::Configure( CCved::ECvedMode mode, double delta, int dynaMult )
 	m_mode		= mode;
 	m_delta		= delta;
 	m_dynaMult	= dynaMult;
+	if( numDynObjs != m_numDynObjs )  SizeDynObjArrays( numDynObjs );
+	GrowVehDynState( numDynObjs );
 
 	// class state transition
 	m_state		= eCONFIGURED;
@@ -288,6 +335,10 @@ CCved::Attach( void )
 		if( count++ > 5 )  return false;		// bailout
 	}
 
+	// Configure is not called before attaching, so the vehicle dynamics
+	// state has to cover the dynamic objects here
+	GrowVehDynState( m_numDynObjs );
+
 	ClassInit();				// do any class specific initializations
 	m_pHdr->numClients++;		// make our presense known
 	m_state = eACTIVE;			// ready to go
@@ -324,6 +375,11 @@ CCved::MemBlockInit( void )
 	for( objId=0, pO=BindObj( objId ); objId<cNUM_DYN_OBJS; objId++, pO++ )
 	{
 		pO->phase = eDEAD;
+		if( (int) objId < m_numDynObjs )
+		{
+			m_dynObjPhase[objId] = eDEAD;
+			m_dynObjType[objId]  = pO->type;
+		}
 	}
 
 	// initialize the few number of slots allocated for
@@ -359,30 +415,32 @@ CCved::MemBlockInit( void )
 void
 CCved::ClassInit(void)
 {
-	// insert all road names in the map
+	// insert all road and intersection names in the name index
+	char *pChPool  = ((char *)m_pHdr) + m_pHdr->charOfs;
+	m_nameIdx.clear();
+	m_nameIdx.reserve(m_pHdr->roadCount + m_pHdr->intrsctnCount +
+					m_pHdr->objectCount);
+
 	TU32b  rid;
 	for (rid=1; rid<m_pHdr->roadCount; rid++) {
-		TRoad *pRdPool = (TRoad *) (((char *)m_pHdr) + m_pHdr->roadOfs);
-		TRoad *pR      = &pRdPool[rid];
-		char *pChPool  = ((char *)m_pHdr) + m_pHdr->charOfs;
+		TRoad *pR = BindRoad(rid);
 
-		m_roadNameMap[pChPool + pR->nameIdx] = rid;
+		m_nameIdx[pChPool + pR->nameIdx].roadId = rid;
 	}
 
-	// insert all intersection names in the map
 	TU32b  iid;
 	for (iid=1; iid<m_pHdr->intrsctnCount; iid++) {
 		TIntrsctn *pI  = BindIntrsctn(iid);
-		char *pChPool  = ((char *)m_pHdr) + m_pHdr->charOfs;
 
-		m_intrsctnNameMap[pChPool + pI->nameIdx] = iid;
+		m_nameIdx[pChPool + pI->nameIdx].intrsctnId = iid;
 	}
 
 	// delete any remaining pointers in the dynamic object pointer cache
 	int objId;
-	for ( objId=0; objId < cNUM_DYN_OBJS; objId++ ) {
+	for ( objId=0; objId < m_numDynObjs; objId++ ) {
 		delete m_dynObjCache[objId];
 		m_dynObjCache[objId] = 0;
+		m_leadObjHints[objId].laneId = -1;
 	}
 
 	// create all the intersection boundary polygons.  We have to
@@ -480,11 +538,7 @@ CCved::ClassInit(void)
 	TU32b  oid;
 	for (oid=cNUM_DYN_OBJS; oid<m_pHdr->objectCount; oid++) {
 		TObj* pObj = BindObj( oid );
-		// Add the object to the list of
-		pair<string, int> pairToInsert;
-		pairToInsert.first = pObj->name;
-		pairToInsert.second = oid;
-		m_objNameToId.insert( pairToInsert );
+		AddObjName( pObj->name, oid );
 	}
     CCved::TIntrsctnVec inters;
     GetAllIntersections(inters);
@@ -538,8 +592,416 @@ CCved::ClassInit(void)
             m_intersectionMap.insert(std::make_pair(crdrId,TQtreeRef(pQtree)));
         }
     }
+
+	BuildSegGeom();
+	BuildCrdrConflicts();
+	BuildHldOfsLinks();
+	BuildAttrIdx();
+	ResetChangeJournal();
+	BuildRouteGraph();
 } // end of ClassInit
 
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function builds the segment geometry tables used by
+//   CRoadPos to convert road positions to world coordinates.
+//
+// Remarks: There is one entry per road and corridor control point,
+//   describing the segment from that control point to the next one.  The
+//   entries are computed exactly as CRoadPos used to compute them on
+//   every call, except that the tangent chords of a corridor never skip
+//   past its last control point.
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::BuildSegGeom(void)
+{
+	TCntrlPnt* pCpPool = (TCntrlPnt *) (((char *)m_pHdr) + m_pHdr->longitCntrlOfs);
+	TCrdrCntrlPnt* pCrdrCpPool =
+		(TCrdrCntrlPnt *) (((char *)m_pHdr) + m_pHdr->crdrCntrlPntOfs);
+	TCrdr* pCrdrPool = (TCrdr *) (((char *)m_pHdr) + m_pHdr->crdrOfs);
+
+	TRoadSegGeom noRoadSeg = { 0.0, 0.0, 0.0 };
+	m_roadSegGeom.assign(m_pHdr->longitCntrlCount, noRoadSeg);
+
+	TU32b  rid;
+	for (rid=1; rid<m_pHdr->roadCount; rid++) {
+		TRoad* pR = BindRoad(rid);
+		unsigned int i;
+		for (i = 0; i + 1 < pR->numCntrlPnt; i++) {
+			TCntrlPnt* pCur = pCpPool + pR->cntrlPntIdx + i;
+			TCntrlPnt* pNex = pCur + 1;
+			TRoadSegGeom& seg = m_roadSegGeom[pR->cntrlPntIdx + i];
+
+			CVector3D ortho(
+					-(pCur->location.y - pNex->location.y),
+					pCur->location.x - pNex->location.x,
+					0.0);
+			ortho.Normalize();
+
+			seg.invLength = 1.0 / pCur->distToNextLinear;
+			seg.orthoI    = ortho.m_i;
+			seg.orthoJ    = ortho.m_j;
+		}
+	}
+
+	TCrdrSegGeom noCrdrSeg = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, false };
+	m_crdrSegGeom.assign(m_pHdr->crdrCntrlPntCount, noCrdrSeg);
+
+	TU32b  cid;
+	for (cid=1; cid<m_pHdr->crdrCount; cid++) {
+		TCrdr* pC = pCrdrPool + cid;
+		int    n  = (int)pC->numCntrlPnt;
+		int    c;
+		for (c = 0; c + 1 < n; c++) {
+			TCrdrCntrlPnt* pCur = pCrdrCpPool + pC->cntrlPntIdx + c;
+			TCrdrCntrlPnt* pNex = pCur + 1;
+			TCrdrSegGeom& seg = m_crdrSegGeom[pC->cntrlPntIdx + c];
+
+			CVector3D ortho(
+					-(pCur->location.y - pNex->location.y),
+					pCur->location.x - pNex->location.x,
+					0.0);
+			ortho.Normalize();
+
+			seg.invLength = 1.0 / (pNex->distance - pCur->distance);
+			seg.orthoI    = ortho.m_i;
+			seg.orthoJ    = ortho.m_j;
+
+			// the first chord skips a next control point closer than 10 ft
+			int last = c + 1;
+			if (pNex->distance - pCur->distance < 10 && last + 1 < n) last++;
+			TCrdrCntrlPnt* pTan = pCrdrCpPool + pC->cntrlPntIdx + last;
+
+			seg.tan1I        = pTan->location.x - pCur->location.x;
+			seg.tan1J        = pTan->location.y - pCur->location.y;
+			seg.invTanLength = 1.0 / (pTan->distance - pCur->distance);
+
+			// and so does the second one, if there is one
+			seg.hasTan2 = (last + 1 < n);
+			if (seg.hasTan2) {
+				int last2 = last + 1;
+				if (pTan->distance - pCur->distance < 10 && last2 + 1 < n) last2++;
+				TCrdrCntrlPnt* pTan2 = pCrdrCpPool + pC->cntrlPntIdx + last2;
+
+				seg.tan2I = pTan2->location.x - pTan->location.x;
+				seg.tan2J = pTan2->location.y - pTan->location.y;
+			}
+		}
+	}
+} // end of BuildSegGeom
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function builds the corridor conflict tables used by
+//   CCrdr and CPath when looking for traffic that crosses a corridor.
+//
+// Remarks: The merge distance matrix of the LRI file has an entry for
+//   every pair of corridors of an intersection, most of which do not
+//   meet.  The conflict table keeps, for each corridor, only the entries
+//   of the corridors it meets, in order of their relative id.  A second
+//   table lists the corridors leading into each lane, in order of their
+//   identifier, so that the corridors approaching a lane can be found
+//   without visiting every corridor of the intersection.
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::BuildCrdrConflicts(void)
+{
+	TCrdr* pCrdrPool = (TCrdr *) (((char *)m_pHdr) + m_pHdr->crdrOfs);
+	cvTCrdrMrgDst* pMrgDstPool =
+		(cvTCrdrMrgDst *) (((char *)m_pHdr) + m_pHdr->crdrMrgDstOfs);
+
+	m_crdrConflicts.clear();
+	m_firstCrdrConflict.assign(m_pHdr->crdrCount + 1, 0);
+
+	TU32b  cid;
+	for (cid=1; cid<m_pHdr->crdrCount; cid++) {
+		m_firstCrdrConflict[cid] = (int)m_crdrConflicts.size();
+
+		TCrdr* pC = pCrdrPool + cid;
+		int    numCrdrs = BindIntrsctn(pC->intrsctnId)->numOfCrdrs;
+		cvTCrdrMrgDst* pEntry = pMrgDstPool + pC->mrgDstIdx;
+		int    other;
+		for (other = 0; other < numCrdrs; other++, pEntry++) {
+			if (pEntry->firstDist != -1) {
+				TCrdrConflict conflict;
+				conflict.crdrId    = other;
+				conflict.firstDist = pEntry->firstDist;
+				conflict.lastDist  = pEntry->lastDist;
+				m_crdrConflicts.push_back(conflict);
+			}
+		}
+	}
+	m_firstCrdrConflict[m_pHdr->crdrCount] = (int)m_crdrConflicts.size();
+
+	// count the corridors leading into each lane, then fill in
+	// their identifiers in increasing order
+	m_firstDstLnCrdr.assign(m_pHdr->laneCount + 1, 0);
+	for (cid=1; cid<m_pHdr->crdrCount; cid++) {
+		m_firstDstLnCrdr[pCrdrPool[cid].dstLnIdx + 1]++;
+	}
+	TU32b  lid;
+	for (lid=0; lid<m_pHdr->laneCount; lid++) {
+		m_firstDstLnCrdr[lid + 1] += m_firstDstLnCrdr[lid];
+	}
+
+	m_dstLnCrdrs.resize(m_firstDstLnCrdr[m_pHdr->laneCount]);
+	vector<int> next(m_firstDstLnCrdr.begin(), m_firstDstLnCrdr.end() - 1);
+	for (cid=1; cid<m_pHdr->crdrCount; cid++) {
+		m_dstLnCrdrs[next[pCrdrPool[cid].dstLnIdx]++] = (int)cid;
+	}
+} // end of BuildCrdrConflicts
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function builds the table that CRoadPos uses to find
+//   the next hold offset ahead of a position.
+//
+// Remarks: There is one entry per lane, describing the corridors that
+//   leave the lane at its next intersection.  Following the entries from
+//   lane to lane gives the same hold offset and distance as visiting the
+//   corridors of every intersection along the way.
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::BuildHldOfsLinks(void)
+{
+	TCrdr* pCrdrPool = (TCrdr *) (((char *)m_pHdr) + m_pHdr->crdrOfs);
+	TCrdrCntrlPnt* pCrdrCpPool =
+		(TCrdrCntrlPnt *) (((char *)m_pHdr) + m_pHdr->crdrCntrlPntOfs);
+
+	TLaneHldOfsLink noLink = { 0, -1, 0.0 };
+	m_laneHldOfsLinks.assign(m_pHdr->laneCount, noLink);
+
+	TU32b  lid;
+	for (lid=0; lid<m_pHdr->laneCount; lid++) {
+		TLane* pL = BindLane(lid);
+		if (pL->roadId <= 0 || pL->roadId >= m_pHdr->roadCount) continue;
+
+		TRoad* pR = BindRoad(pL->roadId);
+		int    iid;
+		if (pL->direction == ePOS)
+			iid = pR->dstIntrsctnIdx;
+		else if (pL->direction == eNEG)
+			iid = pR->srcIntrsctnIdx;
+		else
+			continue;
+
+		TIntrsctn* pI = BindIntrsctn(iid);
+		TLaneHldOfsLink& link = m_laneHldOfsLinks[lid];
+		int    follow = 0;
+		unsigned int c;
+		for (c = 0; c < pI->numOfCrdrs; c++) {
+			TCrdr* pC = pCrdrPool + pI->crdrIdx + c;
+			if (pC->srcLnIdx != lid) continue;
+
+			if (link.hldOfsCrdr == 0 && pC->numHldOfs > 0)
+				link.hldOfsCrdr = pC->myId;
+			if (follow == 0 || (pC->direction == cCV_CRDR_STRAIGHT_DIR &&
+					pCrdrPool[follow].direction != cCV_CRDR_STRAIGHT_DIR))
+				follow = pC->myId;
+		}
+
+		if (follow != 0) {
+			TCrdr* pC = pCrdrPool + follow;
+			TCrdrCntrlPnt* pLast =
+				pCrdrCpPool + pC->cntrlPntIdx + pC->numCntrlPnt - 1;
+			link.nextLane = pC->dstLnIdx;
+			link.nextDist = BindRoad(BindLane(pC->dstLnIdx)->roadId)->roadLengthLinear +
+								pLast->distance;
+		}
+	}
+} // end of BuildHldOfsLinks
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function builds the attribute index used by
+//   CRoad::QryAttr, CRoad::ActiveAttr and CIntrsctn::QryAttr.
+//
+// Remarks: The attributes of each road and intersection are sorted by id
+//   and then by starting distance, so that a query finds the attributes
+//   with a given id by binary search.  The first slots of every road and
+//   intersection are reserved for attributes set at runtime by
+//   SetRoadAttr and SetIntrsctnAttr; they are left out of the index and
+//   searched directly, so the index never has to be updated.
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::BuildAttrIdx(void)
+{
+	const cvTAttr* pAttrPool =
+		(const cvTAttr *) (((char *)m_pHdr) + m_pHdr->attrOfs);
+	auto attrLess = [pAttrPool](int a, int b) -> bool {
+		const cvTAttr& cA = pAttrPool[a];
+		const cvTAttr& cB = pAttrPool[b];
+		if (cA.myId != cB.myId)  return cA.myId < cB.myId;
+		if (cA.from != cB.from)  return cA.from < cB.from;
+		return a < b;
+	};
+
+	m_roadAttrs.clear();
+	m_firstRoadAttr.assign(m_pHdr->roadCount + 1, 0);
+	TU32b  rid;
+	for (rid=1; rid<m_pHdr->roadCount; rid++) {
+		m_firstRoadAttr[rid] = (int)m_roadAttrs.size();
+
+		const cvTRoad* pR = BindRoad(rid);
+		int  i;
+		for (i = cCV_LRI_ROAD_ATTR_EXTRA; i < pR->numAttr; i++) {
+			m_roadAttrs.push_back(pR->attrIdx + i);
+		}
+		sort(m_roadAttrs.begin() + m_firstRoadAttr[rid], m_roadAttrs.end(),
+				attrLess);
+	}
+	m_firstRoadAttr[m_pHdr->roadCount] = (int)m_roadAttrs.size();
+
+	m_intrsctnAttrs.clear();
+	m_firstIntrsctnAttr.assign(m_pHdr->intrsctnCount + 1, 0);
+	TU32b  iid;
+	for (iid=1; iid<m_pHdr->intrsctnCount; iid++) {
+		m_firstIntrsctnAttr[iid] = (int)m_intrsctnAttrs.size();
+
+		const cvTIntrsctn* pI = BindIntrsctn(iid);
+		int  i;
+		for (i = cCV_LRI_INTRSCTN_ATTR_EXTRA; i < pI->numAttr; i++) {
+			m_intrsctnAttrs.push_back(pI->attrIdx + i);
+		}
+		sort(m_intrsctnAttrs.begin() + m_firstIntrsctnAttr[iid],
+				m_intrsctnAttrs.end(), attrLess);
+	}
+	m_firstIntrsctnAttr[m_pHdr->intrsctnCount] = (int)m_intrsctnAttrs.size();
+} // end of BuildAttrIdx
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function builds the road graph used by
+//   CPath::CalculateRoute.
+//
+// Remarks: A road traveled in the positive direction leads to its
+//   destination intersection, and otherwise to its source intersection.
+//   Every corridor of that intersection that starts from the road on a
+//   driving lane becomes an edge of the graph.  The route hierarchy
+//   computed by lricc, if present in the LRI file, is attached to the
+//   graph as well.
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::BuildRouteGraph(void)
+{
+	TCntrlPnt* pCpPool = (TCntrlPnt *) (((char *)m_pHdr) + m_pHdr->longitCntrlOfs);
+
+	m_routeGraph.SetNumRoads(m_pHdr->roadCount);
+
+	TU32b  rid;
+	for (rid=1; rid<m_pHdr->roadCount; rid++) {
+		TRoad* pR = BindRoad(rid);
+		if (pR->numCntrlPnt < 1) continue;
+
+		TCntrlPnt* pFirst = pCpPool + pR->cntrlPntIdx;
+		TCntrlPnt* pLast  = pFirst + pR->numCntrlPnt - 1;
+		m_routeGraph.SetRoadEnds(rid,
+					pFirst->location.x, pFirst->location.y,
+					pLast->location.x, pLast->location.y);
+
+		CRoad road(*this, rid);
+		int d;
+		for (d = 0; d < 2; d++) {
+			cvELnDir dir = (d == 0) ? ePOS : eNEG;
+			CIntrsctn intr = (dir == ePOS) ?
+					road.GetDestIntrsctn() : road.GetSourceIntrsctn();
+
+			if (intr.IsValid()) {
+				TCrdrVec crdrs;
+				intr.GetCrdrsStartingFrom(road, crdrs);
+
+				TCrdrVec::const_iterator itr;
+				for (itr = crdrs.begin(); itr != crdrs.end(); itr++) {
+					// cars cannot drive on this lane
+					if (!itr->GetSrcLn().IsDrivingLane()) continue;
+
+					CRouteGraph::TEdge edge;
+					edge.srcRoad = rid;
+					edge.srcDir  = dir;
+					edge.crdrId  = itr->GetRelativeId();
+					edge.dstRoad = itr->GetDstntnRdIdx();
+					edge.dstDir  = itr->GetDstntnLn().GetDirection();
+					edge.length  = pR->roadLengthLinear + itr->GetLength();
+					m_routeGraph.AddEdge(edge);
+				}
+			}
+		}
+	}
+
+	m_routeGraph.Finalize();
+
+	// the route hierarchy fields were added at the end of the header.
+	// lricc writes the first pool right after the header, so in a file
+	// written with the older, shorter header the first pool starts
+	// before the end of the current one and these fields hold pool data;
+	// they are taken as zero, and routes are found by the A* search
+	TU32b hierNodeCount = m_pHdr->routeHierNodeCount;
+	TU32b hierNodeOfs   = m_pHdr->routeHierNodeOfs;
+	TU32b hierEdgeOfs   = m_pHdr->routeHierEdgeOfs;
+	if (m_pHdr->charOfs < sizeof(cvTHeader)) {
+		hierNodeCount = 0;
+		hierNodeOfs   = 0;
+		hierEdgeOfs   = 0;
+	}
+
+	// use the route hierarchy if the LRI file was compiled with one
+	if (hierNodeCount > 0) {
+		m_routeGraph.SetHierarchy(
+				(cvTRouteHierNode *) (((char *)m_pHdr) + hierNodeOfs),
+				hierNodeCount,
+				(cvTRouteHierEdge *) (((char *)m_pHdr) + hierEdgeOfs));
+	}
+} // end of BuildRouteGraph
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function returns the road graph used for route
+//   planning.
+//
+// Remarks: The graph is built when the LRI file is loaded.
+//
+// Arguments:
+//
+// Returns: A const reference to the road graph.
+//
+//////////////////////////////////////////////////////////////////////////////
+const CRouteGraph&
+CCved::GetRouteGraph() const
+{
+	return m_routeGraph;
+} // end of GetRouteGraph
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description: This function initilializes the internal data structures
@@ -650,7 +1112,6 @@ CCved::Init(const string& cLriName, string& message)
 		return false;
 	}
 
-	// verify the version
 	// unlike earlier, this is now just a warning
     if ( head.majorVersionNum != gGetMajorCvedVersionNum() ||
 			head.minorVersionNum != gGetMinorCvedVersionNum() ||
@@ -728,7 +1189,7 @@ CCved::Init(const string& cLriName, string& message)
 
 	fclose(pF);
 
-	m_objNameToId.clear();
+	m_nameIdx.clear();
 
 	MemBlockInit();				// do any necessary initializations
 	ClassInit();				// do any class specific initializations
@@ -765,10 +1226,13 @@ CCved::ReInit(void)
 	MemBlockInit();
 
 	int objId;
-	for ( objId=0; objId < cNUM_DYN_OBJS; objId++ ) {
+	for ( objId=0; objId < m_numDynObjs; objId++ ) {
 		delete m_dynObjCache[objId];
 		m_dynObjCache[objId] = 0;
+		m_leadObjHints[objId].laneId = -1;
 	}
+	ClearQryMemo();
+	ResetChangeJournal();
 } // end of ReInit
 
 //////////////////////////////////////////////////////////////////////////////
@@ -813,19 +1277,19 @@ CCved::Maintainer(void)
 
 	// implement the object phase transition diagram
 	LockObjectPool();
-	for (i=0, pO = BindObj(0); i<cNUM_DYN_OBJS; i++, pO++) {
-		if ( pO->phase == eBORN ) {
+	for (i=0; i<m_numDynObjs; i++) {
+		if ( GetDynObjPhase( i ) == eBORN ) {
 			if ( m_debug > 2 ) {
 				gout << "Object " << i << " from Born->Alive " << endl;
 			}
-			pO->phase = eALIVE;
+			SetDynObjPhase( i, eALIVE );
 		}
 		else
-		if ( pO->phase == eDYING ) {
+		if ( GetDynObjPhase( i ) == eDYING ) {
 			if ( m_debug > 2 ) {
 				gout << "Object " << i << " from Dying->Dead " << endl;
 			}
-			pO->phase = eDEAD;
+			SetDynObjPhase( i, eDEAD );
 			m_pHdr->dynObjectCount--;
 		}
 	}
@@ -833,10 +1297,11 @@ CCved::Maintainer(void)
 	//
 	// Copy dynamic object state between buffers.
 	//
-	for( i = 0, pO = BindObj( 0 ); i < cNUM_DYN_OBJS; i++, pO++ )
+	for( i = 0; i < m_numDynObjs; i++ )
 	{
-		if( pO->phase == eALIVE )
+		if( GetDynObjPhase( i ) == eALIVE )
 		{
+			pO = BindObj( i );
 			if( (m_pHdr->frame & 1) == 0 )
 			{		// even frame
 				pO->stateBufA.state = pO->stateBufB.state;
@@ -851,6 +1316,7 @@ CCved::Maintainer(void)
 	UnlockObjectPool();
 
 	FillByRoadDynObjList();
+	ClearQryMemo();
 
 #ifdef DEBUG_MAINTAINER
 if( m_pHdr->frame > 0 ) {
@@ -1072,10 +1538,12 @@ CCved::ExecuteDynamicModels(  )
 	TObjectPoolIdx id;
 	TObj*          pO;
 	int            count = 0; // optimization
-	TObjectPoolIdx attachedObjIds[cNUM_DYN_OBJS]; // list of objects that are attached to others
+	vector<TObjectPoolIdx>& attachedObjIds = m_attachedObjIds;
+	                                              // list of objects that are attached to others
 	                                              // they need to be processed after their parents
 	                                              // are processed.
-	TObjectPoolIdx freeMotionObjIds[cNUM_DYN_OBJS]; // list of objects in free motion. The main
+	vector<TObjectPoolIdx>& freeMotionObjIds = m_freeMotionObjIds;
+	                                                // list of objects in free motion. The main
 	                                                // loop will create the ode objects for them
 	                                                // if they are newly transitioned to free motion
 	                                                // mode, while the second loop processes them
@@ -1098,8 +1566,15 @@ CCved::ExecuteDynamicModels(  )
 	}
 	pO = BindObj( id );
 
-	while( id < cNUM_DYN_OBJS )
+	while( id < (TObjectPoolIdx) m_numDynObjs )
 	{
+		if( GetDynObjPhase( id ) == eDEAD )
+		{
+			id++;
+			pO++;
+			continue;
+		}
+
         if (pO->phase == eDYING){
             //m_ExternalControllers.OnPushDeleteObject(id);
         }
@@ -1554,16 +2029,9 @@ CCved::GetRoad(int id) const
 CRoad
 CCved::GetRoad(const string &cName) const
 {
-	CRoad RetVal;
+	int id = GetRoadIdByName(cName);
 
-	TStr2IntMap::const_iterator  item;
-
-	item = m_roadNameMap.find(cName);
-	if ( item != m_roadNameMap.end() && (*item).second > 0 ) {
-		CRoad r(*this, (*item).second);
-		return r;
-	}
-	if ( item == m_roadNameMap.end() ) {
+	if ( id == 0 ) {
 		string msg;
 
 		msg = "invalid road:";
@@ -1572,10 +2040,38 @@ CCved::GetRoad(const string &cName) const
 		throw e;
 	}
 
-	return RetVal;
+	CRoad r(*this, id);
+	return r;
 } // end of GetRoad
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function returns the identifier of the road whose
+//   name is given as an argument.
+//
+// Remarks: The lookup uses the name index built when the LRI file is
+//   loaded, so its cost does not depend on the number of roads.  Lanes
+//   are identified relative to their road, so once the road is known the
+//   lane is reached directly through the road's laneIdx.
+//
+// Arguments:
+//   cName - the name of the road
+//
+// Returns: The identifier of the road, or 0 if no road has that name.
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CCved::GetRoadIdByName(const string &cName) const
+{
+	TNameIdx::const_iterator item = m_nameIdx.find(cName);
+
+	if ( item == m_nameIdx.end() )
+		return 0;
+	return item->second.roadId;
+} // end of GetRoadIdByName
+
+
 //////////////////////////////////////////////////////////////////////////////
 //	Intersection related
 //////////////////////////////////////////////////////////////////////////////
@@ -1656,16 +2152,9 @@ CCved::GetIntersection(int id) const
 CIntrsctn
 CCved::GetIntersection(const string &cName) const
 {
-	CIntrsctn rval;		// an invalid one, in case we can't find it
+	int id = GetIntrsctnIdByName(cName);
 
-	TStr2IntMap::const_iterator  item;
-
-	item = m_intrsctnNameMap.find(cName);
-	if ( item != m_intrsctnNameMap.end() && (*item).second > 0 ) {
-		CIntrsctn i(*this, (*item).second);
-		return i;
-	}
-	if ( item == m_intrsctnNameMap.end() ) {
+	if ( id == 0 ) {
 		string msg;
 
 		msg = "invalid intersection: ";
@@ -1676,9 +2165,39 @@ CCved::GetIntersection(const string &cName) const
 		throw e;
 	}
 
-	return rval;
+	CIntrsctn i(*this, id);
+	return i;
 } // end of GetIntersection
 
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description:
+// 	This function returns the identifier of the intersection whose name is
+// 	given as an argument.
+//
+// Remarks: The lookup uses the name index built when the LRI file is
+// 	loaded.  Corridors are identified relative to their intersection, so
+// 	once the intersection is known the corridor is reached directly through
+// 	the intersection's crdrIdx.
+//
+// Arguments:
+// 	cName - the name of the intersection
+//
+// Return value: The identifier of the intersection, or 0 if no
+// 	intersection has that name.
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CCved::GetIntrsctnIdByName(const string &cName) const
+{
+	TNameIdx::const_iterator item = m_nameIdx.find(cName);
+
+	if ( item == m_nameIdx.end() )
+		return 0;
+	return item->second.intrsctnId;
+} // end of GetIntrsctnIdByName
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  Returns the total number of intersections.
@@ -1800,11 +2319,10 @@ CCved::GetNumDynamicObjs(CObjTypeMask mask) const
 {
 	int    count = 0;
 	int    i;
-	TObj  *pO;
 
-	for (i=0, pO = BindObj(0); i<cNUM_DYN_OBJS; i++, pO++) {
-		if ( pO->phase == eALIVE || pO->phase == eDYING ) {
-			if ( mask.Has(pO->type) ) count++;
+	for (i=0; i<m_numDynObjs; i++) {
+		if ( GetDynObjPhase( i ) == eALIVE || GetDynObjPhase( i ) == eDYING ) {
+			if ( mask.Has((cvEObjType) GetDynObjType( i )) ) count++;
 		}
 	}
 
@@ -1906,11 +2424,10 @@ void
 CCved::GetAllDynamicObjs(TIntVec &out, CObjTypeMask mask) const
 {
 	int    i;
-	TObj  *pO;
 	out.clear();
-	for (i=0, pO = BindObj(0); i<cNUM_DYN_OBJS; i++, pO++) {
-		if ( pO->phase == eALIVE || pO->phase == eDYING ) {
-			if ( mask.Has(pO->type) ) out.push_back(i);
+	for (i=0; i<m_numDynObjs; i++) {
+		if ( GetDynObjPhase( i ) == eALIVE || GetDynObjPhase( i ) == eDYING ) {
+			if ( mask.Has((cvEObjType) GetDynObjType( i )) ) out.push_back(i);
 		}
 	}
 } // end of GetAllDynamicObjs
@@ -2181,6 +2698,240 @@ CCved::GetChangedStaticObjsNear(
 	}
 } // GetChangedStaticObjsNear
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function returns the static objects that have changed
+//  since the last time this function was called with the same changedId.
+//
+// Remarks: Unlike GetChangedStaticObjsNear, this function does not search
+//  for objects; it reads the changes recorded by the functions that modify
+//  static objects since the previous call, so its cost depends only on the
+//  number of changes.  Each object is reported once, in the order of its
+//  first change, even if it changed several times.
+//
+//  The two functions share the changed flag of the objects, so an object
+//  reported by one of them for a changedId is not reported again by the
+//  other.  If more than cCV_CHANGE_JOURNAL_SIZE changes were made since
+//  the previous call, the oldest ones are no longer recorded and all the
+//  static objects are checked instead.  Only changes made through this
+//  CCved instance are recorded; a client that shares the memory block with
+//  other instances should use GetChangedStaticObjsNear.
+//
+// Arguments:
+//  changedId - the id of the client, used so more than one client can query
+//      for changed objects; must be less than cCV_NUM_CHANGE_CONSUMERS,
+//      otherwise no objects are returned.
+//	out - the STL vector to hold the object identifiers
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::GetChangedStaticObjs( TU8b changedId, TIntVec& out ) const
+{
+	out.clear();
+	if( changedId >= cCV_NUM_CHANGE_CONSUMERS )  return;
+
+	TU8b changedMask = 1 << changedId;
+	TU32b& read = m_changeJournalRead[changedId];
+
+	bool journalOverrun = m_changeJournalEnd - read > cCV_CHANGE_JOURNAL_SIZE;
+	if( journalOverrun )
+	{
+		TU32b objId;
+		for( objId = cNUM_DYN_OBJS; objId < m_pHdr->objectCount; objId++ )
+		{
+			TObj* pO = BindObj( objId );
+			if( pO->changedFlag & changedMask )
+			{
+				out.push_back( objId );
+				pO->changedFlag &= ~changedMask;
+			}
+		}
+	}
+	else
+	{
+		for( ; read != m_changeJournalEnd; read++ )
+		{
+			int objId = m_changeJournal[read % cCV_CHANGE_JOURNAL_SIZE];
+			TObj* pO = BindObj( objId );
+			if( pO->changedFlag & changedMask )
+			{
+				out.push_back( objId );
+				pO->changedFlag &= ~changedMask;
+			}
+		}
+	}
+
+	read = m_changeJournalEnd;
+} // GetChangedStaticObjs
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: MarkObjChanged (protected)
+//  Flags an object as changed for all clients, and records the change in
+//  the journal read by GetChangedStaticObjs if the object is static.
+//
+// Arguments:
+//  objId - the identifier of the modified object
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::MarkObjChanged( int objId )
+{
+	TObj* pO = BindObj( objId );
+	pO->changedFlag = 0xFF;
+
+	if( objId >= cNUM_DYN_OBJS )
+	{
+		m_changeJournal[m_changeJournalEnd % cCV_CHANGE_JOURNAL_SIZE] = objId;
+		m_changeJournalEnd++;
+	}
+} // end of MarkObjChanged
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: ResetChangeJournal (protected)
+//  Empties the journal of changed static objects, as when the memory
+//  block is initialized.
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::ResetChangeJournal( void )
+{
+	m_changeJournalEnd = 0;
+	int i;
+	for( i = 0; i < cCV_NUM_CHANGE_CONSUMERS; i++ )
+	{
+		m_changeJournalRead[i] = 0;
+	}
+} // end of ResetChangeJournal
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SetDynObjPhase (protected)
+//  Sets the phase of a dynamic object, both in the object pool and in the
+//  compact copy used by the scans over all the dynamic objects.
+//
+// Remarks: All changes to the phase of a dynamic object must go through
+//  this function.
+//
+// Arguments:
+//  objId - the identifier of the dynamic object
+//  phase - the new phase, a cvEObjPhase
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::SetDynObjPhase( int objId, int phase ) const
+{
+	BindObj( objId )->phase = (cvEObjPhase) phase;
+	m_dynObjPhase[objId] = (TU8b) phase;
+} // end of SetDynObjPhase
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetDynObjPhase (protected)
+//  Returns the phase of a dynamic object.
+//
+// Remarks: The compact copy is only kept up to date by the instance that
+//  creates and deletes the objects.  An instance attached to the memory
+//  block of another one (multi user mode) does not see those changes, so
+//  it reads the phase from the object pool.
+//
+// Arguments:
+//  objId - the identifier of the dynamic object
+//
+// Returns: The phase of the object, a cvEObjPhase.
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CCved::GetDynObjPhase( int objId ) const
+{
+	if( m_mode == eCV_MULTI_USER )  return BindObj( objId )->phase;
+	return m_dynObjPhase[objId];
+} // end of GetDynObjPhase
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetDynObjType (protected)
+//  Returns the type of a dynamic object.
+//
+// Remarks: As with GetDynObjPhase, an attached instance reads the type
+//  from the object pool.
+//
+// Arguments:
+//  objId - the identifier of the dynamic object
+//
+// Returns: The type of the object, a cvEObjType.
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CCved::GetDynObjType( int objId ) const
+{
+	if( m_mode == eCV_MULTI_USER )  return BindObj( objId )->type;
+	return m_dynObjType[objId];
+} // end of GetDynObjType
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SizeDynObjArrays (protected)
+//  Sizes the per dynamic object bookkeeping for the given number of
+//  dynamic objects and resets it.
+//
+// Remarks: The cached CDynObj instances are deleted.
+//
+// Arguments:
+//  numDynObjs - the number of dynamic objects, at most cNUM_DYN_OBJS
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::SizeDynObjArrays( int numDynObjs )
+{
+	vector<CDynObj*>::iterator itr;
+	for( itr = m_dynObjCache.begin(); itr != m_dynObjCache.end(); itr++ )
+	{
+		delete *itr;
+	}
+
+	TLeadObjHint noHint;
+	noHint.laneId    = -1;
+	noHint.leadObjId = -1;
+
+	m_numDynObjs = numDynObjs;
+	m_dynObjCache.assign( numDynObjs, (CDynObj*) 0 );
+	m_leadObjHints.assign( numDynObjs, noHint );
+	m_dynObjPhase.assign( numDynObjs, (TU8b) eDEAD );
+	m_dynObjType.assign( numDynObjs, (TU8b) 0 );
+	m_attachedObjIds.resize( numDynObjs );
+	m_freeMotionObjIds.resize( numDynObjs );
+} // end of SizeDynObjArrays
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetDynObjCapacity
+//  Returns the number of dynamic objects that can exist at the same time.
+//
+// Remarks: The capacity is set by Configure and never exceeds
+//  cNUM_DYN_OBJS.  Identifiers of dynamic objects are smaller than the
+//  capacity.
+//
+// Returns: The number of dynamic object slots in use.
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CCved::GetDynObjCapacity( void ) const
+{
+	return m_numDynObjs;
+} // end of GetDynObjCapacity
+
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -2218,6 +2969,20 @@ CCved::GetTrafLightsNear(
 			int maxSize
 			)
 {
+	// the key is only built when the results are memoized, so that the
+	// query costs nothing extra otherwise
+	if( m_qryMemoEnabled )
+	{
+		TQryMemoKey key(
+					eQRY_TRAF_LIGHTS_NEAR, maxSize, 0, CObjTypeMask(), loc, 0 );
+		const TIntVec* pMemo = FindQryMemo( key );
+		if( pMemo )
+		{
+			copy( pMemo->begin(), pMemo->end(), pCvedId );
+			return (int) pMemo->size();
+		}
+	}
+
 #ifdef _WIN32
 	WaitForSingleObject(m_MUTEX_LightsNear,1);
 #endif
@@ -2301,6 +3066,13 @@ CCved::GetTrafLightsNear(
 #ifdef _WIN32
 	ReleaseMutex(m_MUTEX_LightsNear);
 #endif
+	if( m_qryMemoEnabled )
+	{
+		TQryMemoKey key(
+					eQRY_TRAF_LIGHTS_NEAR, maxSize, 0, CObjTypeMask(), loc, 0 );
+		TIntVec memo( pCvedId, pCvedId + outSize );
+		AddQryMemo( key, memo.begin(), memo.end() );
+	}
 	return outSize;
 }
 
@@ -2342,7 +3114,18 @@ CCved::GetObjsNear(
 	double    radiusSquare = radius * radius;  // avoid square roots
 
 	out.clear();
-	pO = BindObj(0);
+
+	if( m_qryMemoEnabled )
+	{
+		TQryMemoKey key( eQRY_OBJS_NEAR, 0, 0, mask, cLoc, radius );
+		const TIntVec* pMemo = FindQryMemo( key );
+		if( pMemo )
+		{
+			out = *pMemo;
+			return;
+		}
+	}
+
 	CBoundingBox bbox(
 					cLoc.m_x - radius,
 					cLoc.m_y - radius,
@@ -2350,16 +3133,15 @@ CCved::GetObjsNear(
 					cLoc.m_y + radius);
 	// for dynamic object
 	i  = 0;
-	for(; i < cNUM_DYN_OBJS; i++){
-		if ( pO->phase == eALIVE || pO->phase == eDYING ) {
-			if ( mask.Has(pO->type) ) {
+	for(; i < m_numDynObjs; i++){
+		if ( GetDynObjPhase( i ) == eALIVE || GetDynObjPhase( i ) == eDYING ) {
+			if ( mask.Has((cvEObjType) GetDynObjType( i )) ) {
 				objPos = GetObjPos(i);
 				if ( bbox.Encloses(objPos) ) {
 					out.push_back(i);
 				}
 			}
 		}
-		pO++;
 	}
 
 	// for static objects in the LRI
@@ -2388,6 +3170,12 @@ CCved::GetObjsNear(
 		}
 	}
 
+	if( m_qryMemoEnabled )
+	{
+		TQryMemoKey key( eQRY_OBJS_NEAR, 0, 0, mask, cLoc, radius );
+		AddQryMemo( key, out.begin(), out.end() );
+	}
+
 
 #if 0
 	while ( i < m_pHdr->objectCount ) {
@@ -2454,23 +3242,28 @@ CCved::GetObj(const string &cObjName, int &objId) const
 {
 	TObj  *pO;
 
-	// linear search was too slow, so now we search through the multimap and
-	// return the first object with the given name.  In the future, this may
-	// be expanded (or another method added) to return all objects with the
-	// given name.
+	// linear search was too slow, so now we search through the name index
+	// and return the first object with the given name.  The slots listed
+	// in the index may have been reused by an object created through
+	// another CVED instance, so the name is checked as well.
 	objId = -1;
-	multimap<string,int>::const_iterator lb = m_objNameToId.lower_bound( cObjName );
-	multimap<string,int>::const_iterator ub = m_objNameToId.upper_bound( cObjName );
-	for ( ; lb != ub; lb++ ) {
-		pO = BindObj( lb->second );
-		if ( pO->phase == eALIVE || pO->phase == eDYING ) {
-			objId = pO->myId;
-			return true;
+	TNameIdx::const_iterator item = m_nameIdx.find( cObjName );
+	if ( item != m_nameIdx.end() ) {
+		vector<int>::const_iterator i;
+		for ( i = item->second.objIds.begin(); i != item->second.objIds.end(); i++ ) {
+			pO = BindObj( *i );
+			if ( ( pO->phase == eALIVE || pO->phase == eDYING ) &&
+					!strncmp( cObjName.c_str(), pO->name, cOBJ_NAME_LEN-1 ) ) {
+				objId = pO->myId;
+				return true;
+			}
 		}
 	}
 
-	// Haven't found it yet.  Try a linear search on dynamic objects, because
-	// attached cved's won't have the multimap initialized.
+	// Haven't found it yet.  Objects created by this instance are always
+	// in the index, but attached cved's don't see the objects created by
+	// the instance that owns the memory block, so they search linearly.
+	if ( m_mode != eCV_MULTI_USER ) return false;
 
 	return GetObjLinear( cObjName, objId );
 } // end of GetObj
@@ -2484,16 +3277,19 @@ CCved::GetObj(const string &cObjName, vector<int> &objId) const
 	TObj tObj;
     tObj.myId =-1;
 #endif
-	// Search through the multimap and return all objects with the given name.
-	// Will not work when the shared memory interface is used because
-	// the multimap does not get updated (???)
+	// Search through the name index and return all objects with the given
+	// name.  Will not work when the shared memory interface is used because
+	// the index is only updated for objects created by this instance.
 	objId.clear();
-	multimap<string,int>::const_iterator lb = m_objNameToId.lower_bound( cObjName );
-	multimap<string,int>::const_iterator ub = m_objNameToId.upper_bound( cObjName );
-	for ( ; lb != ub; lb++ ) {
-		pO = BindObj( lb->second );
-		if ( pO->phase == eALIVE || pO->phase == eDYING ) {
-			objId.push_back(pO->myId);
+	TNameIdx::const_iterator item = m_nameIdx.find( cObjName );
+	if ( item != m_nameIdx.end() ) {
+		vector<int>::const_iterator i;
+		for ( i = item->second.objIds.begin(); i != item->second.objIds.end(); i++ ) {
+			pO = BindObj( *i );
+			if ( ( pO->phase == eALIVE || pO->phase == eDYING ) &&
+					!strncmp( cObjName.c_str(), pO->name, cOBJ_NAME_LEN-1 ) ) {
+				objId.push_back(pO->myId);
+			}
 		}
 	}
 
@@ -2507,7 +3303,11 @@ CCved::GetObj(const string &cObjName, vector<int> &objId) const
 //  This function looks through all available objects until it finds one whose
 //  name matches the parameter.
 //
-// Remarks:
+// Remarks: This search is needed for objects created through another
+//  CVED instance attached to the same memory block, since those never
+//  enter the name index of this instance.  The name index is not updated
+//  here, so that concurrent lookups through the const GetObj only read
+//  it; objects created by this instance enter it through AddObjName.
 //
 // Arguments:
 //  cObjName - the name to look for
@@ -2525,17 +3325,11 @@ CCved::GetObjLinear(const string &cObjName, int &objId) const
     int   i;
     TObj  *pO;
 
-
-    // For now, we perform a simple linear search.
-    // If this function becomes a bottleneck, we will have to
-    // manually create a hash table that can be stored in the
-    // memory block.  Keep in mind that a regular STL container
-    // won't work since it won't be shared by all CVED instances.
     objId = -1;
     i     = 0;
     pO    = BindObj( i );
-    while ( i < cNUM_DYN_OBJS ) {
-        if ( pO->phase == eALIVE || pO->phase == eDYING ) {
+    while ( i < m_numDynObjs ) {
+        if ( GetDynObjPhase( i ) == eALIVE || GetDynObjPhase( i ) == eDYING ) {
             if ( cObjName == pO->name ) {
                 objId = i;
                 return true;
@@ -2546,7 +3340,59 @@ CCved::GetObjLinear(const string &cObjName, int &objId) const
     }
 
     return false;
-} // end of GetObj
+} // end of GetObjLinear
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Adds an object to the name index.
+//
+// Remarks: An object identifier appears at most once under a given name.
+//
+// Arguments:
+//  cObjName - the name of the object
+//  objId - the identifier of the object
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::AddObjName(const string &cObjName, int objId)
+{
+	vector<int>& ids = m_nameIdx[cObjName].objIds;
+
+	if ( find( ids.begin(), ids.end(), objId ) == ids.end() )
+		ids.push_back( objId );
+} // end of AddObjName
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Removes an object from the name index.
+//
+// Remarks: The entry itself is kept, since names of deleted objects are
+//  usually reused by the objects created after them.
+//
+// Arguments:
+//  cObjName - the name of the object
+//  objId - the identifier of the object
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::RemoveObjName(const string &cObjName, int objId)
+{
+	TNameIdx::iterator item = m_nameIdx.find( cObjName );
+
+	if ( item != m_nameIdx.end() ) {
+		vector<int>& ids = item->second.objIds;
+		vector<int>::iterator i = find( ids.begin(), ids.end(), objId );
+
+		if ( i != ids.end() )
+			ids.erase( i );
+	}
+} // end of RemoveObjName
 
 
 
@@ -2630,6 +3476,25 @@ CCved::GetAllDynObjsOnRoad(
 		return;
 	}
 
+	size_t firstResult = result.size();
+	if( m_qryMemoEnabled )
+	{
+		TQryMemoKey key(
+					eQRY_DYN_OBJS_ON_ROAD,
+					roadId,
+					(TU32b) lanes.to_ulong(),
+					cMask,
+					CPoint3D(),
+					0
+					);
+		const TIntVec* pMemo = FindQryMemo( key );
+		if( pMemo )
+		{
+			result.insert( result.end(), pMemo->begin(), pMemo->end() );
+			return;
+		}
+	}
+
 	int curIdx = m_pRoadRefPool[roadId].objIdx;
 	cvEObjType type;
 
@@ -2676,8 +3541,18 @@ CCved::GetAllDynObjsOnRoad(
 		curIdx = m_pDynObjRefPool[curIdx].next;
 	}
 
-
-
+	if( m_qryMemoEnabled )
+	{
+		TQryMemoKey key(
+					eQRY_DYN_OBJS_ON_ROAD,
+					roadId,
+					(TU32b) lanes.to_ulong(),
+					cMask,
+					CPoint3D(),
+					0
+					);
+		AddQryMemo( key, result.begin() + firstResult, result.end() );
+	}
 } // end of GetAllDynObjsOnRoad
 
 //////////////////////////////////////////////////////////////////////////////
@@ -3535,7 +4410,7 @@ CCved::CreateDynObj(
 			}
 			return 0;
 		}
-		pO->phase = eBORN;
+		SetDynObjPhase( objId, eBORN );
 	}
 	else if ( type == eCV_EXTERNAL_TRAILER ) {
 		objId = 1;
@@ -3552,9 +4427,14 @@ CCved::CreateDynObj(
 			}
 			return 0;
 		}
-		pO->phase = eBORN;
+		SetDynObjPhase( objId, eBORN );
 	}
 	else {
+		// the header may remember a slot beyond the configured
+		// number of dynamic objects
+		if ( m_pHdr->lastObjAlloc >= m_numDynObjs )  {
+			m_pHdr->lastObjAlloc = m_numDynObjs - 1;
+		}
 		objId = m_pHdr->lastObjAlloc;
 		do {
 			objId++;
@@ -3562,12 +4442,12 @@ CCved::CreateDynObj(
 				objId = cMAX_EXT_CNTRL_OBJS;
 			}
 			else
-			if ( objId == cNUM_DYN_OBJS )  {
+			if ( objId == m_numDynObjs )  {
 				objId = cMAX_EXT_CNTRL_OBJS;
 			}
 
-			pO = BindObj(objId);
-		} while ( pO->phase != eDEAD && objId != m_pHdr->lastObjAlloc );
+		} while ( GetDynObjPhase( objId ) != eDEAD && objId != m_pHdr->lastObjAlloc );
+		pO = BindObj(objId);
 
 		if ( m_debug > 2 ) {
 			gout << "found one : " << objId << endl << flush;
@@ -3577,7 +4457,7 @@ CCved::CreateDynObj(
 			return 0;
 		}
 		m_pHdr->lastObjAlloc = objId;
-		pO->phase            = eBORN;
+		SetDynObjPhase( objId, eBORN );
 	}
 
 	UnlockObjectPool();
@@ -3592,12 +4472,10 @@ CCved::CreateDynObj(
 	//
 	pO->myId = objId;
 	pO->type = type;
+	m_dynObjType[objId] = type;
 	strncpy_s(pO->name, cName.c_str(), cOBJ_NAME_LEN-1);
 
-	pair<string, int> pairToInsert;
-	pairToInsert.first = cName;
-	pairToInsert.second = objId;
-	m_objNameToId.insert( pairToInsert );
+	AddObjName( cName, objId );
 
 	// set up the cAttributes; we simply copy whatever
 	// the user provided into the allocated slot.
@@ -3752,6 +4630,9 @@ CCved::CreateStaticObj(
 	objId = m_pHdr->objectCount++;
 	UnlockObjectPool();
 
+	// GetObjsNear reports the new object right away
+	ClearQryMemo();
+
 	TObj* pO = BindObj( objId );
 	pO->phase = eALIVE;
 	pO->myId = objId;
@@ -3765,7 +4646,7 @@ CCved::CreateStaticObj(
 	pO->attr = cAttr;
 //	m_pHdr->objectAttrCount++;
 //	m_pHdr->attrCount++;
-	pO->changedFlag  = 0xFF;
+	MarkObjChanged( objId );
 
 	cvTObjStateBuf defaultVals = { 0 };
 	defaultVals.state.anyState.tangent.i = 1.0;
@@ -3824,10 +4705,7 @@ CCved::CreateStaticObj(
 
 	UpdateObjRefList( objId );
 
-	pair<string, int> pairToInsert;
-	pairToInsert.first = cName;
-	pairToInsert.second = objId;
-	m_objNameToId.insert( pairToInsert );
+	AddObjName( cName, objId );
 
 	return objId;
 } // end of CreateStaticObj
@@ -4173,7 +5051,7 @@ CCved::GetRunTimeDynObjType(cvEObjType type)
 const CDynObj *
 CCved::BindObjIdToClass(int objId)
 {
-	if ( objId < 0 || objId > cNUM_DYN_OBJS )
+	if ( objId < 0 || objId >= m_numDynObjs )
 		return 0;
 
 	TObj  *pO = BindObj(objId);
@@ -4232,7 +5110,7 @@ CCved::BindObjIdToClass(int objId)
 CDynObj *
 CCved::BindObjIdToClass2(int objId)
 {
-	if ( objId < 0 || objId > cNUM_DYN_OBJS )
+	if ( objId < 0 || objId >= m_numDynObjs )
 		return NULL;
 
 	TObj  *pO = BindObj(objId);
@@ -4288,20 +5166,10 @@ void
 CCved::DeleteDynObj(CDynObj *pObj)
 {
 	assert(pObj);
-	TObj *pO  = BindObj(pObj->GetId());
-
 	LockObjectPool();
-	pO->phase = eDYING;
+	SetDynObjPhase( pObj->GetId(), eDYING );
 	UnlockObjectPool();
-	int id = pObj->GetId();
-	multimap<string,int>::iterator lb = m_objNameToId.lower_bound( pObj->GetName() );
-	multimap<string,int>::iterator ub = m_objNameToId.upper_bound( pObj->GetName() );
-	for ( ; lb != ub; lb++ ) {
-		if ( id == lb->second ) {
-			m_objNameToId.erase( lb );
-			break;
-		}
-	}
+	RemoveObjName( pObj->GetName(), pObj->GetId() );
 	delete pObj;
 } // end of DeleteDynObj
 
@@ -4512,39 +5380,113 @@ CCved::GetEnvArea( int id, CEnvArea& area ) const
 	}
 	else
 	{
-		area = m_envAreas[id - 1];
+		area = m_envAreas[id - 1];
+	}
+
+	return true;
+}
+
+void
+CCved::GetEnvArea( const CPoint2D& pt, vector<CEnvArea>& areas )
+{
+	GetEnvArea( pt.m_x, pt.m_y, areas );
+}
+
+
+void
+CCved::GetEnvArea( const CPoint3D& pt, vector<CEnvArea>& areas )
+{
+	GetEnvArea( pt.m_x, pt.m_y, areas );
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function returns the environment areas that contain
+//  the given point.
+//
+// Remarks: The global area is not included.  The areas are found through
+//  a quadtree over their extents and returned in order of id.  The first
+//  version copies the areas; the second one returns pointers to the
+//  areas kept by CCved, which remain valid until the next call to
+//  CreateEnvArea.
+//
+// Arguments:
+//  x, y - The point.
+//  areas - A container to hold the environment areas.
+//
+// Return:
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::GetEnvArea( double x, double y, vector<CEnvArea>& areas )
+{
+	areas.clear();
+
+	vector<int> ids;
+	GetEnvAreaIds( x, y, ids );
+	vector<int>::const_iterator i;
+	for( i = ids.begin(); i != ids.end(); i++ )
+	{
+		areas.push_back( m_envAreas[*i - 1] );
 	}
-
-	return true;
 }
 
 void
-CCved::GetEnvArea( const CPoint2D& pt, vector<CEnvArea>& areas )
+CCved::GetEnvArea(
+			double x,
+			double y,
+			vector<const CEnvArea*>& areas
+			) const
 {
-	GetEnvArea( pt.m_x, pt.m_y, areas );
-}
+	areas.clear();
 
+	vector<int> ids;
+	GetEnvAreaIds( x, y, ids );
+	vector<int>::const_iterator i;
+	for( i = ids.begin(); i != ids.end(); i++ )
+	{
+		areas.push_back( &m_envAreas[*i - 1] );
+	}
+}
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function returns the identifiers of the environment
+//  areas that contain the given point.
+//
+// Remarks: The global area, whose identifier is 0, is not included.  The
+//  identifiers are in increasing order and can be passed to GetEnvArea.
+//
+// Arguments:
+//  x, y - The point.
+//  ids - A container to hold the identifiers.
+//
+// Return:
+//
+//////////////////////////////////////////////////////////////////////////////
 void
-CCved::GetEnvArea( const CPoint3D& pt, vector<CEnvArea>& areas )
+CCved::GetEnvAreaIds( double x, double y, vector<int>& ids ) const
 {
-	GetEnvArea( pt.m_x, pt.m_y, areas );
-}
+	ids.clear();
+	if( m_envAreas.empty() )  return;
 
+	// the quadtree yields the areas whose extent is near the point
+	m_envAreaQTree.SearchRectangle( x - 1, y - 1, x + 1, y + 1, ids );
+	sort( ids.begin(), ids.end() );
 
-void
-CCved::GetEnvArea( double x, double y, vector<CEnvArea>& areas )
-{
-	areas.clear();
-	vector<CEnvArea>::iterator i;
-	for( i = m_envAreas.begin(); i != m_envAreas.end(); i++ )
+	// keep those that actually contain the point
+	vector<int>::iterator last = ids.begin();
+	vector<int>::const_iterator i;
+	for( i = ids.begin(); i != ids.end(); i++ )
 	{
-		bool pointInsideArea = i->Enclose( x, y );
+		bool pointInsideArea = m_envAreas[*i - 1].Enclose( x, y );
 		if( pointInsideArea )
 		{
-			areas.push_back( *i );
+			*last++ = *i;
 		}
 	}
+	ids.erase( last, ids.end() );
 }
 
 CEnvArea
@@ -4655,11 +5597,58 @@ CCved::CreateEnvArea(
 	// the vector that holds all non-global areas
 	CEnvArea envArea( *this, m_pHdr->envAreaCount - 1 );
 	m_envAreas.push_back( envArea );
+	BuildEnvAreaQTree();
 
 	return true;
 }
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: This function builds the quadtree used by GetEnvArea to
+//  find the environment areas that contain a point.
+//
+// Remarks: The quadtree holds the extent of the polygon of every area in
+//  m_envAreas, keyed by the identifier of the area.  Areas are created
+//  rarely, so the tree is rebuilt from scratch each time one is added,
+//  which keeps it balanced.
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::BuildEnvAreaQTree(void)
+{
+	m_envAreaQTree = CQuadTree();
+
+	const cvTEnviroArea* pAreaPool = reinterpret_cast<const cvTEnviroArea*>(
+				reinterpret_cast<char *>(m_pHdr) + m_pHdr->envAreaOfs );
+	int id;
+	for( id = 1; id <= (int) m_envAreas.size(); id++ )
+	{
+		const cvTEnviroArea* pArea = pAreaPool + id;
+		if( pArea->numOfPolyPts <= 0 )  continue;
+
+		double x1 = pArea->polyPt[0].x;
+		double y1 = pArea->polyPt[0].y;
+		double x2 = x1;
+		double y2 = y1;
+		int i;
+		for( i = 1; i < pArea->numOfPolyPts; i++ )
+		{
+			x1 = min( x1, pArea->polyPt[i].x );
+			y1 = min( y1, pArea->polyPt[i].y );
+			x2 = max( x2, pArea->polyPt[i].x );
+			y2 = max( y2, pArea->polyPt[i].y );
+		}
+		m_envAreaQTree.Add( id, x1, y1, x2, y2 );
+	}
+	m_envAreaQTree.Optimize();
+} // end of BuildEnvAreaQTree
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description:  This function add environmental conditions to an area.
@@ -4818,7 +5807,7 @@ void
 CCved::SetTrafficLightState( int objId, eCVTrafficLightState state )
 {
 	TObj* pO = BindObj( objId );
-	pO->changedFlag = 0xFF;
+	MarkObjChanged( objId );
 
 	// Set both buffers with the understanding that traffic lights
 	// state is not propagated by the maintainer.
@@ -4845,7 +5834,7 @@ void
 CCved::SetVehicleAudioState( int objId, int state )
 {
 	TObj* pO = BindObj( objId );
-	pO->changedFlag = 0xFF;
+	MarkObjChanged( objId );
 	if( (m_pHdr->frame & 1) == 0 )
 	{
 		pO->stateBufB.state.anyState.audioState = state;
@@ -4875,7 +5864,7 @@ void
 CCved::SetVehicleVisualState( int objId, int state )
 {
 	TObj* pO = BindObj( objId );
-	pO->changedFlag = 0xFF;
+	MarkObjChanged( objId );
 	if( (m_pHdr->frame & 1) == 0 )
 	{
 		pO->stateBufB.state.anyState.visualState = state;
@@ -6782,7 +7771,7 @@ CCved::SetObjCompositeOptions( int objId, const int* pOptions )
 		}
 	}
 
-	pO->changedFlag = 0xFF;
+	MarkObjChanged( objId );
 	return true;
 }
 
@@ -6858,7 +7847,7 @@ CCved::SetObjOption( int objId, int option )
 
 	// else, everything must be valid.
 	pO->activeOption = option;
-	pO->changedFlag = 0xFF;
+	MarkObjChanged( objId );
 
 //	if ( objId < cNUM_DYN_OBJS )
 //		printf("%d set option step4, option = %d\n", objId, option);
@@ -6906,7 +7895,7 @@ CCved::SetObjAudioState( int objId, short state, bool instant )
 			// odd frame
 			pO->stateBufA.state.anyState.audioState = state;
 		}
-		pO->changedFlag = 0xFF;
+		MarkObjChanged( objId );
 	}else{
 			pO->stateBufB.state.anyState.audioState = state;
 			pO->stateBufA.state.anyState.audioState = state;
@@ -7005,7 +7994,7 @@ CCved::SetObjVisualState( int objId, short state, bool instant )
 		pO->stateBufB.state.anyState.visualState = state;
 		pO->stateBufA.state.anyState.visualState = state;
 	}
-	pO->changedFlag = 0xFF;
+	MarkObjChanged( objId );
 
 //	if ( objId < cNUM_DYN_OBJS )
 //		printf("%d set option step4, option = %d\n", objId, option);
@@ -7068,6 +8057,11 @@ CCved::GetObjVisualState( int objId, short &state) const
 ///  to be called for more than cCV_LRI_ROAD_ATTR_EXTRA different
 ///  attributes, it will return false
 ///
+///  Setting an attribute discards the routes cached by the road graph.
+///  Turn lane and vehicle restriction lane attributes also change the
+///  lanes on which routes can be planned, so the road graph is rebuilt
+///  and the route hierarchy stored in the LRI file is no longer used.
+///
 /// Arguments:
 ///  rd - road to be set attribute to
 ///  attrId - attribute id defined in cveddecl.h
@@ -7111,6 +8105,19 @@ CCved::SetRoadAttr(
 			pAttr->from = from;
 			pAttr->to = to;
 			pAttr->laneMask = laneMask;
+
+			// routes computed before the change may no longer be valid
+			if (attrId == cCV_VEHICLE_RESTRICTION_LANE_ATTR ||
+					attrId == cCV_TURN_LANE_ATTR) {
+				// the lanes cars can drive on have changed, so has the
+				// road graph; the route hierarchy computed by lricc
+				// reflects the old lanes and can no longer be used
+				BuildRouteGraph();
+				m_routeGraph.SetHierarchy(0, 0, 0);
+			}
+			else {
+				m_routeGraph.ClearRouteCache();
+			}
 			return true;
 		}
 	}
@@ -7221,6 +8228,8 @@ CCved::SetIntrsctnAttr(
 ///  to be called for more than cCV_LRI_CRDR_ATTR_EXTRA different
 ///  attributes, it will return false
 ///
+///  Setting an attribute discards the routes cached by the road graph.
+///
 /// Arguments:
 ///  crdr - corridor to be set attribute to
 ///  crdrId - relative id of corridor to be set attribute to
@@ -7264,6 +8273,9 @@ CCved::SetCrdrAttr(
 			pAttr->value2 = value2;
 			pAttr->from = from;
 			pAttr->to = to;
+
+			// routes computed before the change may no longer be valid
+			m_routeGraph.ClearRouteCache();
 			return true;
 		}
 	}
@@ -7406,41 +8418,23 @@ CCved::BuildFwdObjList(
 			//
 			if( samePathPointAsOwner )
 			{
-				int curIdx;
 				if( roadPos.IsRoad() )
 				{
 					int currRoadId = roadPos.GetRoad().GetId();
-					curIdx = m_pRoadRefPool[currRoadId].objIdx;
-
-					while( curIdx != 0 )
-					{
-						if( m_pDynObjRefPool[curIdx].objId == ownerObjId )
-						{
-							ownerDist = m_pDynObjRefPool[curIdx].distance;
-							break;
-						}
-
-						curIdx = m_pDynObjRefPool[curIdx].next;
-					}
-
+					const cvTDynObjRef* pOwnerDor =
+								GetRoadDynObjRef( ownerObjId, currRoadId );
+					if( pOwnerDor )  ownerDist = pOwnerDor->distance;
 				}
 				else
 				{
 					int currIntrsctnId = roadPos.GetIntrsctn().GetId();
-					curIdx = m_pIntrsctnRefPool[currIntrsctnId].objIdx;
-
-					while( curIdx != 0 )
+					const cvTDynObjRef* pOwnerDor =
+								GetIntrsctnDynObjRef( ownerObjId, currIntrsctnId );
+					if( pOwnerDor )
 					{
-						if( m_pDynObjRefPool[curIdx].objId == ownerObjId )
-						{
-							int crdrId = roadPos.GetCorridor().GetRelativeId();
-							ownerDist = m_pDynObjRefPool[curIdx].crdrDistances[crdrId];
-							break;
-						}
-
-						curIdx = m_pDynObjRefPool[curIdx].next;
+						int crdrId = roadPos.GetCorridor().GetRelativeId();
+						ownerDist = pOwnerDor->crdrDistances[crdrId];
 					}
-
 				}
 
 				if( ownerDist < -100.0 )
@@ -7991,18 +8985,9 @@ CCved::BuildBackObjList(
 	cvELnDir currLaneDir = currLane.GetDirection();
 
 	{
-		int curIdx = m_pRoadRefPool[currRoad.GetId()].objIdx;
-
-		while( curIdx != 0 )
-		{
-			if( m_pDynObjRefPool[curIdx].objId == ownerObjId )
-			{
-				ownerDist = m_pDynObjRefPool[curIdx].distance;
-				break;
-			}
-
-			curIdx = m_pDynObjRefPool[curIdx].next;
-		}
+		const cvTDynObjRef* pOwnerDor =
+					GetRoadDynObjRef( ownerObjId, currRoad.GetId() );
+		if( pOwnerDor )  ownerDist = pOwnerDor->distance;
 
 		if( ownerDist < -100.0 )
 		{
@@ -8409,7 +9394,6 @@ CCved::BuildOncomingObjList(
 
 
 			int currRoadId = currRoad.GetId();
-			int curIdx = m_pRoadRefPool[currRoadId].objIdx;
 
 			//
 			// Get the owner distance from the list. The distance from the roadPos
@@ -8418,15 +9402,9 @@ CCved::BuildOncomingObjList(
 			//
 			if( samePathPointAsOwner )
 			{
-				while( curIdx != 0 )
-				{
-					if( m_pDynObjRefPool[curIdx].objId == ownerObjId )
-					{
-						ownerDist = m_pDynObjRefPool[curIdx].distance;
-						break;
-					}
-					curIdx = m_pDynObjRefPool[curIdx].next;
-				}
+				const cvTDynObjRef* pOwnerDor =
+							GetRoadDynObjRef( ownerObjId, currRoadId );
+				if( pOwnerDor )  ownerDist = pOwnerDor->distance;
 			}
 
 			if( ownerDist < -100.0 )
@@ -8440,7 +9418,7 @@ CCved::BuildOncomingObjList(
 					ownerDist = roadPos.GetDistance();
 			}
 
-			curIdx = m_pRoadRefPool[currRoadId].objIdx;
+			int curIdx = m_pRoadRefPool[currRoadId].objIdx;
 
 			//
 			// Insert objects into the oncoming list until there are no
@@ -9655,41 +10633,23 @@ CCved::BuildBackObjList2(
 
 
 	// Get owner distance from obj ref list.
-	int curIdx;
 	if( roadPos.IsRoad() )
 	{
 		int currRoadId = roadPos.GetRoad().GetId();
-		curIdx = m_pRoadRefPool[currRoadId].objIdx;
-
-		while( curIdx != 0 )
-		{
-			if( m_pDynObjRefPool[curIdx].objId == ownerObjId )
-			{
-				ownerDist = m_pDynObjRefPool[curIdx].distance;
-				break;
-			}
-
-			curIdx = m_pDynObjRefPool[curIdx].next;
-		}
-
+		const cvTDynObjRef* pOwnerDor =
+					GetRoadDynObjRef( ownerObjId, currRoadId );
+		if( pOwnerDor )  ownerDist = pOwnerDor->distance;
 	}
 	else
 	{
 		int currIntrsctnId = roadPos.GetIntrsctn().GetId();
-		curIdx = m_pIntrsctnRefPool[currIntrsctnId].objIdx;
-
-		while( curIdx != 0 )
+		const cvTDynObjRef* pOwnerDor =
+					GetIntrsctnDynObjRef( ownerObjId, currIntrsctnId );
+		if( pOwnerDor )
 		{
-			if( m_pDynObjRefPool[curIdx].objId == ownerObjId )
-			{
-				int crdrId = roadPos.GetCorridor().GetRelativeId();
-				ownerDist = m_pDynObjRefPool[curIdx].crdrDistances[crdrId];
-				break;
-			}
-
-			curIdx = m_pDynObjRefPool[curIdx].next;
+			int crdrId = roadPos.GetCorridor().GetRelativeId();
+			ownerDist = pOwnerDor->crdrDistances[crdrId];
 		}
-
 	}
 
 	if( ownerDist < -100.0 )
@@ -10701,7 +11661,6 @@ CCved::GetFirstObjOnIntrsctingCrdr(
 	gout << objs.size() << endl;
 #endif
 
-	bool found = false;
 	bool lookOnSrcLane = false;
 
 	// If there are vehicles before the intersecting point on the
@@ -10710,32 +11669,7 @@ CCved::GetFirstObjOnIntrsctingCrdr(
 	{
 		// Get the last intersecting distance of this intersecting corridor
 		// with the other corridor.
-		double intrsctingDist=0;
-		/*static*/ vector<double> dists;
-
-		//double intrsctingDist;
-		/*static*/
-
-		interCrdr.GetMrgDstLast( dists );
-		unsigned int i;
-
-		for( i = 0; i < dists.size(); i++ )
-		{
-			// The index of the vector matches the corridor Id.
-			if( i ==crdrId )
-			{
-				found = true;
-				intrsctingDist = dists[i];
-
-#ifdef DEBUG_FIRST_OBJ
-				gout << " intrsctingDist of crdr: " << interCrdrId;
-			    gout << " with " << crdrId << " = " << intrsctingDist << endl;
-#endif
-
-				break;
-			}
-		}
-		if( !found )
+		if( crdrId < 0 || crdrId >= interCrdr.GetIntrsctn().GetNumCrdrs() )
 		{
 
 #ifdef DEBUG_FIRST_OBJ
@@ -10744,13 +11678,17 @@ CCved::GetFirstObjOnIntrsctingCrdr(
 #endif
 			return -1;
 		}
+		double intrsctingDist = interCrdr.GetLastMrgDist( crdrId );
+
+#ifdef DEBUG_FIRST_OBJ
+		gout << " intrsctingDist of crdr: " << interCrdrId;
+		gout << " with " << crdrId << " = " << intrsctingDist << endl;
+#endif
+
         if (intrsctingDist < 0){
             //if the last point of itersection is -1, chances are this intersection
             //merges in with our target.
-            vector<double> firstdist;
-            int id = i;
-            interCrdr.GetMrgDstFirst(firstdist);
-            if (firstdist[i] > 0){
+            if (interCrdr.GetFirstMrgDist( crdrId ) > 0){
                 intrsctingDist = interCrdr.GetLength();
             }
         }
@@ -11712,6 +12650,144 @@ CCved::GetOwnVehicleInfo(
 }	// end of GetOwnVehicleInfo
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: FindObjWithDist (local)
+// 	Finds an object in a list of objects sorted by distance.
+//
+// Remarks: The distance must be the one stored in the list for the
+// 	object; objects at the same distance are searched in order.
+//
+// Arguments:
+// 	objs - the list, in increasing order of distance
+// 	objId - the object to find
+// 	dist - the distance of the object
+//
+// Returns: the index of the object in the list, or -1 if it is not there.
+//
+//////////////////////////////////////////////////////////////////////////////
+static int
+FindObjWithDist(
+			const vector<CCved::TObjWithDist>& objs,
+			int objId,
+			double dist
+			)
+{
+	int lo = 0;
+	int hi = (int) objs.size();
+	while( lo < hi )
+	{
+		int mid = ( lo + hi ) / 2;
+		if( objs[mid].dist < dist )
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	for( ; lo < (int) objs.size() && objs[lo].dist == dist; lo++ )
+	{
+		if( objs[lo].objId == objId )  return lo;
+	}
+
+	return -1;
+} // end of FindObjWithDist
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetTrackedLeadObj (protected)
+// 	Checks whether the lead obj that GetLeadObj found last time for an
+// 	obj on its lane is still its lead obj.
+//
+// Remarks: The check walks the road's reference list, which is sorted
+// 	by distance, from the input obj to the lead obj (or from the lead
+// 	obj to the input obj when traveling towards the start of the road)
+// 	and fails if another obj of the mask is on the lane between them.
+// 	When it succeeds, the result is the one GetLeadObj would get by
+// 	searching the list of objs on the lane.
+//
+// Arguments:
+// 	objId       - the input obj id.
+// 	lane        - the lane of the input obj.
+// 	withRoadDir - whether the lead obj is searched in the direction of
+// 	              the lane.
+// 	objMask     - the types of objs that can be lead objs.
+// 	objDist     - the distance of the input obj along the road.
+// 	leadObjId   - (output) the lead obj id of the input obj.
+// 	followDist  - (output) dist from input obj center to lead obj center.
+//
+// Returns: true if the lead obj is still valid, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CCved::GetTrackedLeadObj(
+			int objId,
+			const CLane& lane,
+			bool withRoadDir,
+			const CObjTypeMask& objMask,
+			double objDist,
+			int& leadObjId,
+			double& followDist
+			) const
+{
+	if( objId < 0 || objId >= m_numDynObjs )  return false;
+
+	const TLeadObjHint& hint = m_leadObjHints[objId];
+	if( hint.laneId < 0 || hint.laneId != lane.GetId() )  return false;
+	if( hint.leadObjId == objId )  return false;
+
+	int roadId = lane.GetRoad().GetId();
+	const cvTDynObjRef* pObjDor = GetRoadDynObjRef( objId, roadId );
+	const cvTDynObjRef* pLeadDor = GetRoadDynObjRef( hint.leadObjId, roadId );
+	if( !pObjDor || !pLeadDor )  return false;
+
+	// the same test GetAllDynObjsOnLane uses to build the lane list
+	int laneId = lane.GetRelativeId();
+	auto isInLaneList = [&]( const cvTDynObjRef* pDor ) -> bool
+	{
+		bitset<cCV_MAX_LANES> objLanes( (int)pDor->lanes );
+		return objLanes[laneId] && objMask.Has( GetObjType( pDor->objId ) );
+	};
+	if( !isInLaneList( pObjDor ) || !isInLaneList( pLeadDor ) )  return false;
+
+	//if the object is not Active, GetLeadObj doesn't find it
+	if( !( IsObjValid( objId ) && IsDynObj( objId ) ) )  return false;
+	const TObj* pObj = BindObj( objId );
+	if( !pObj || !( pObj->phase == eALIVE || pObj->phase == eDYING ) )
+	{
+		return false;
+	}
+
+	int objIdx = (int)( pObjDor - m_pDynObjRefPool );
+	int leadIdx = (int)( pLeadDor - m_pDynObjRefPool );
+	int firstIdx, lastIdx;
+	cvELnDir laneDir = lane.GetDirection();
+	if( ( laneDir == ePOS && withRoadDir ) || ( laneDir == eNEG && !withRoadDir ) )
+	{
+		firstIdx = objIdx;
+		lastIdx = leadIdx;
+	}
+	else if( ( laneDir == eNEG && withRoadDir ) || ( laneDir == ePOS && !withRoadDir ) )
+	{
+		firstIdx = leadIdx;
+		lastIdx = objIdx;
+	}
+	else
+	{
+		return false;
+	}
+
+	int curIdx = m_pDynObjRefPool[firstIdx].next;
+	while( curIdx != 0 && curIdx != lastIdx )
+	{
+		if( isInLaneList( &m_pDynObjRefPool[curIdx] ) )  return false;
+		curIdx = m_pDynObjRefPool[curIdx].next;
+	}
+	if( curIdx != lastIdx )  return false;
+
+	leadObjId = hint.leadObjId;
+	followDist = fabs( pLeadDor->distance - objDist );
+	return true;
+} // end of GetTrackedLeadObj
 
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -11725,7 +12801,13 @@ CCved::GetOwnVehicleInfo(
 ///  the next intersection. If the input obj is on intersection, this function checks
 ///  if it has lead obj on the same corridor. If yes, it gets the lead obj; if no, it
 ///  will check the destination lane of the corridor for a possible lead obj. This function
-///  ignores signs, traffic lights or coordniators as potential lead objects
+///  ignores signs, traffic lights or coordniators as potential lead objects.
+///  A lead obj found on the input obj's lane is remembered, and on the next call it
+///  is checked against the road's object list before the lane is searched again.
+///  Although the function is const, it updates the remembered lead obj of the
+///  input obj without a lock.  Calls for different objects may run concurrently,
+///  but calls for the same obj must not overlap, and no call may overlap with
+///  the Maintainer.
 ///  Arguments:
 ///
 ///\par 	objId      - the input obj id.
@@ -11775,6 +12857,25 @@ CCved::GetLeadObj(int objId, int& leadObjId, double& followDist, const CPath* pa
 
 		if( !lane.IsValid() )	return false;
 
+		// Most objs keep the same lead obj for many frames, so the one
+		// found last time is checked before searching the lane.
+		if( GetTrackedLeadObj(
+					objId,
+					lane,
+					withRoadDir,
+					objMask,
+					roadPos.GetDistance(),
+					leadObjId,
+					followDist
+					) )
+		{
+			return true;
+		}
+		if( objId >= 0 && objId < m_numDynObjs )
+		{
+			m_leadObjHints[objId].laneId = -1;
+		}
+
 		// Get all objs on the input obj lane.
 		vector<TObjWithDist> objsOnLane;
 		GetAllDynObjsOnLane( lane, objsOnLane,objMask );
@@ -11794,66 +12895,72 @@ CCved::GetLeadObj(int objId, int& leadObjId, double& followDist, const CPath* pa
 		bool foundInputObj = false;
 		double objDist = roadPos.GetDistance();
 
-		for( unsigned int i = 0; i < objsOnLane.size(); i++ )
+		// The input obj is located in the lane list through the distance
+		// of its own entry in the road's reference list.
+		const cvTDynObjRef* pObjDor =
+					GetRoadDynObjRef( objId, lane.GetRoad().GetId() );
+		int objIdx = -1;
+		if( pObjDor )
 		{
-			if ( !(IsObjValid(objsOnLane[i].objId) && IsDynObj(objsOnLane[i].objId )))
-				continue;
-
-			TObj* obj = BindObj(objsOnLane[i].objId);
-
-			if (!obj) //we do not have a object
-				continue;
-
-			//if the object is not Active, don't get it
-			if (!(obj->phase == eALIVE || obj->phase == eDYING)){
-				continue;
-			}
+			objIdx = FindObjWithDist( objsOnLane, objId, pObjDor->distance );
+		}
 
+		//if the object is not Active, don't get it
+		bool objActive = false;
+		if( objIdx >= 0 && IsObjValid( objId ) && IsDynObj( objId ) )
+		{
+			TObj* obj = BindObj( objId );
+			objActive = obj && ( obj->phase == eALIVE || obj->phase == eDYING );
+		}
 
-			if( objsOnLane[i].objId == objId )
-			{
-				foundInputObj = true;
+		if( objActive )
+		{
+			unsigned int i = objIdx;
+			foundInputObj = true;
 
-				if( i < objsOnLane.size() - 1 && ((lane.GetDirection() == ePOS  && withRoadDir) ||
+			if( i < objsOnLane.size() - 1 && ((lane.GetDirection() == ePOS  && withRoadDir) ||
                                                   (lane.GetDirection() == eNEG  && !withRoadDir) ) )
-				{
+			{
 
 
-					leadObjId = objsOnLane[i+1].objId;
-					followDist = fabs( objsOnLane[i+1].dist - objDist );
+				leadObjId = objsOnLane[i+1].objId;
+				followDist = fabs( objsOnLane[i+1].dist - objDist );
 
 #ifdef	DEBUG_GET_LEAD_OBJ
-					gout << " input obj = " << objId;
-					gout << " lead obj = " << leadObjId;
-					gout << " follow dist = " << followDist;
-					gout << endl << endl;
-					gout << " followDist = fabs( objsOnLane[i+1].dist - objDist ) " << endl;
-					gout << " objsOnLane[i+1].dist = " << objsOnLane[i+1].dist;
-					gout << " objDist = " << objDist << endl << endl << endl;;
-#endif
-					return true;
+				gout << " input obj = " << objId;
+				gout << " lead obj = " << leadObjId;
+				gout << " follow dist = " << followDist;
+				gout << endl << endl;
+				gout << " followDist = fabs( objsOnLane[i+1].dist - objDist ) " << endl;
+				gout << " objsOnLane[i+1].dist = " << objsOnLane[i+1].dist;
+				gout << " objDist = " << objDist << endl << endl << endl;;
+#endif
+				m_leadObjHints[objId].laneId = lane.GetId();
+				m_leadObjHints[objId].leadObjId = leadObjId;
+				return true;
 
-				}
-				if( i > 0 && ( (lane.GetDirection() == eNEG && withRoadDir) ||
+			}
+			if( i > 0 && ( (lane.GetDirection() == eNEG && withRoadDir) ||
                                (lane.GetDirection() == ePOS && !withRoadDir) ))
-				{
-					leadObjId = objsOnLane[i-1].objId;
-					followDist = fabs( objsOnLane[i-1].dist - objDist );
+			{
+				leadObjId = objsOnLane[i-1].objId;
+				followDist = fabs( objsOnLane[i-1].dist - objDist );
 
 #ifdef	DEBUG_GET_LEAD_OBJ
-					gout << " input obj = " << objId;
-					gout << " lead obj = " << leadObjId;
-					gout << " follow dist = " << followDist;
-					gout << endl << endl;
-					gout << " followDist = fabs( objsOnLane[i-1].dist - objDist ) " << endl;
-					gout << " objsOnLane[i-1].dist = " << objsOnLane[i-1].dist;
-					gout << " objDist = " << objDist << endl << endl << endl;
-#endif
-					return true;
+				gout << " input obj = " << objId;
+				gout << " lead obj = " << leadObjId;
+				gout << " follow dist = " << followDist;
+				gout << endl << endl;
+				gout << " followDist = fabs( objsOnLane[i-1].dist - objDist ) " << endl;
+				gout << " objsOnLane[i-1].dist = " << objsOnLane[i-1].dist;
+				gout << " objDist = " << objDist << endl << endl << endl;
+#endif
+				m_leadObjHints[objId].laneId = lane.GetId();
+				m_leadObjHints[objId].leadObjId = leadObjId;
+				return true;
 
-				}
 			}
-		}	// for
+		}
 
 		if( !foundInputObj ){ //	return false;
 			if ((objDist < overLapPad || objDist > lane.GetRoad().GetCubicLength() - overLapPad )&& objsOnLane.size()>0){
@@ -12306,42 +13413,52 @@ CCved::GetLeadObj(int objId, int& leadObjId, double& followDist, const CPath* pa
 
 		bool foundInputObj = false;
 
-		for( unsigned int j = 0; j < objsOnCrdr.size(); j++ )
+		// The input obj is located in the sorted corridor list through
+		// the distance of its own entry in the intersection's list.
+		const cvTDynObjRef* pObjDor = GetIntrsctnDynObjRef( objId, intrsctnId );
+		int objIdx = -1;
+		if( pObjDor )
 		{
-			if( objsOnCrdr[j].objId == objId  )
-			{
-				foundInputObj = true;
+			objIdx = FindObjWithDist(
+						objsOnCrdr,
+						objId,
+						pObjDor->crdrDistances[crdrId]
+						);
+		}
 
-				if (withRoadDir){
-                    if( j < objsOnCrdr.size() - 1 )
-				    {
-					    leadObjId = objsOnCrdr[j+1].objId;
-					    followDist = objsOnCrdr[j+1].dist - objDist;
-
-    #ifdef	DEBUG_GET_LEAD_OBJ
-					    gout << " input obj = " << objId;
-					    gout << " lead obj = " << leadObjId;
-					    gout << " follow dist = " << followDist;
-					    gout << endl << endl;
-					    gout << " followDist = objsOnCrdr[j+1].dist - objDist " << endl;
-					    gout << " objsOnCrdr[j+1].dist = " << objsOnCrdr[j+1].dist;
-					    gout << " objDist = " << objDist << endl << endl << endl;
-    #endif
-					    return true;
+		if( objIdx >= 0 )
+		{
+			unsigned int j = objIdx;
+			foundInputObj = true;
 
-				    }
-                }else{
-                    if( j > 0 )
-				    {
-					    leadObjId = objsOnCrdr[j-1].objId;
-					    followDist = objDist - objsOnCrdr[j-1].dist;
-                        return true;
-                    }
+			if (withRoadDir){
+				if( j < objsOnCrdr.size() - 1 )
+				{
+					leadObjId = objsOnCrdr[j+1].objId;
+					followDist = objsOnCrdr[j+1].dist - objDist;
 
-                }
+#ifdef	DEBUG_GET_LEAD_OBJ
+					gout << " input obj = " << objId;
+					gout << " lead obj = " << leadObjId;
+					gout << " follow dist = " << followDist;
+					gout << endl << endl;
+					gout << " followDist = objsOnCrdr[j+1].dist - objDist " << endl;
+					gout << " objsOnCrdr[j+1].dist = " << objsOnCrdr[j+1].dist;
+					gout << " objDist = " << objDist << endl << endl << endl;
+#endif
+					return true;
+
+				}
+			}else{
+				if( j > 0 )
+				{
+					leadObjId = objsOnCrdr[j-1].objId;
+					followDist = objDist - objsOnCrdr[j-1].dist;
+					return true;
+				}
 
 			}
-		}	// for
+		}
 
 		if( !foundInputObj ){
 			if (objDist < overLapPad && objsOnCrdr.size()>0){
@@ -368,4 +368,205 @@ CCvedItem::GetIntrsctnGrid(int intrsctnId) const
 {
 	return m_cpCved->m_intrsctnGrids[intrsctnId];
 } // end of GetIntsctnGrid
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetIntrsctnBorder
+// 	Returns the border polygon of the given intersection.  This data is
+// 	stored within CCved.
+//
+// Remarks: Unlike CIntrsctn::GetBorder, this function does not build a new
+// 	polygon, so it is suitable for code that tests many intersections.
+//
+// Arguments:
+// 	intrsctnId - identifier of the intersection of interest
+//
+// Returns: A const reference to the CPolygon2D instance stored in CCved.
+//
+//////////////////////////////////////////////////////////////////////////////
+const CPolygon2D&
+CCvedItem::GetIntrsctnBorder(int intrsctnId) const
+{
+	return m_cpCved->m_intrsctnBndrs[intrsctnId];
+} // end of GetIntrsctnBorder
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetRoadSegGeom
+// 	Returns the precomputed geometry of the road segment starting at the
+// 	given control point.  This data is stored within CCved.
+//
+// Remarks: The entry of the last control point of a road is not used.
+//
+// Arguments:
+// 	cntrlPntIdx - index of the control point in the control point pool
+//
+// Returns: A const reference to the TRoadSegGeom stored in CCved.
+//
+//////////////////////////////////////////////////////////////////////////////
+const TRoadSegGeom&
+CCvedItem::GetRoadSegGeom(int cntrlPntIdx) const
+{
+	return m_cpCved->m_roadSegGeom[cntrlPntIdx];
+} // end of GetRoadSegGeom
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetCrdrSegGeom
+// 	Returns the precomputed geometry of the corridor segment starting at
+// 	the given control point.  This data is stored within CCved.
+//
+// Remarks: The entry of the last control point of a corridor is not used.
+//
+// Arguments:
+// 	cntrlPntIdx - index of the control point in the corridor control
+// 		point pool
+//
+// Returns: A const reference to the TCrdrSegGeom stored in CCved.
+//
+//////////////////////////////////////////////////////////////////////////////
+const TCrdrSegGeom&
+CCvedItem::GetCrdrSegGeom(int cntrlPntIdx) const
+{
+	return m_cpCved->m_crdrSegGeom[cntrlPntIdx];
+} // end of GetCrdrSegGeom
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetCrdrConflicts
+// 	Returns the corridors of the same intersection that the given
+// 	corridor crosses or merges with, along with the distances at which
+// 	they meet.  This data is stored within CCved.
+//
+// Remarks: The entries are in order of the relative id of the other
+// 	corridor.
+//
+// Arguments:
+// 	crdrIdx - index of the corridor in the corridor pool
+// 	num - (output) the number of entries
+//
+// Returns: A pointer to the first entry, valid while CCved is loaded.
+//
+//////////////////////////////////////////////////////////////////////////////
+const TCrdrConflict*
+CCvedItem::GetCrdrConflicts(int crdrIdx, int& num) const
+{
+	int first = m_cpCved->m_firstCrdrConflict[crdrIdx];
+	num = m_cpCved->m_firstCrdrConflict[crdrIdx + 1] - first;
+	return num > 0 ? &m_cpCved->m_crdrConflicts[first] : 0;
+} // end of GetCrdrConflicts
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetDstLnCrdrs
+// 	Returns the identifiers of the corridors whose destination is the
+// 	given lane.  This data is stored within CCved.
+//
+// Remarks: The identifiers are in increasing order.
+//
+// Arguments:
+// 	laneIdx - index of the lane in the lane pool
+// 	num - (output) the number of corridors
+//
+// Returns: A pointer to the first identifier, valid while CCved is loaded.
+//
+//////////////////////////////////////////////////////////////////////////////
+const int*
+CCvedItem::GetDstLnCrdrs(int laneIdx, int& num) const
+{
+	int first = m_cpCved->m_firstDstLnCrdr[laneIdx];
+	num = m_cpCved->m_firstDstLnCrdr[laneIdx + 1] - first;
+	return num > 0 ? &m_cpCved->m_dstLnCrdrs[first] : 0;
+} // end of GetDstLnCrdrs
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetLaneHldOfsLink
+// 	Returns where the lookahead for the next hold offset goes from the
+// 	end of the given lane.  This data is stored within CCved.
+//
+// Remarks:
+//
+// Arguments:
+// 	laneIdx - index of the lane in the lane pool
+//
+// Returns: A const reference to the TLaneHldOfsLink stored in CCved.
+//
+//////////////////////////////////////////////////////////////////////////////
+const TLaneHldOfsLink&
+CCvedItem::GetLaneHldOfsLink(int laneIdx) const
+{
+	return m_cpCved->m_laneHldOfsLinks[laneIdx];
+} // end of GetLaneHldOfsLink
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetRoadAttrs
+// 	Returns the attributes of the given road that were compiled into the
+// 	LRI file, as indexes into the attribute pool.  This data is stored
+// 	within CCved.
+//
+// Remarks: The indexes are sorted by attribute id, then by the starting
+// 	distance of the attribute, then by index.  The slots reserved for
+// 	attributes set at runtime are not included.
+//
+// Arguments:
+// 	roadIdx - index of the road in the road pool
+// 	num - (output) the number of attributes
+//
+// Returns: A pointer to the first index, valid while CCved is loaded.
+//
+//////////////////////////////////////////////////////////////////////////////
+const int*
+CCvedItem::GetRoadAttrs(int roadIdx, int& num) const
+{
+	int first = m_cpCved->m_firstRoadAttr[roadIdx];
+	num = m_cpCved->m_firstRoadAttr[roadIdx + 1] - first;
+	return num > 0 ? &m_cpCved->m_roadAttrs[first] : 0;
+} // end of GetRoadAttrs
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetIntrsctnAttrs
+// 	Returns the attributes of the given intersection that were compiled
+// 	into the LRI file, as indexes into the attribute pool.  This data is
+// 	stored within CCved.
+//
+// Remarks: The indexes are sorted as those of GetRoadAttrs.
+//
+// Arguments:
+// 	intrsctnIdx - index of the intersection in the intersection pool
+// 	num - (output) the number of attributes
+//
+// Returns: A pointer to the first index, valid while CCved is loaded.
+//
+//////////////////////////////////////////////////////////////////////////////
+const int*
+CCvedItem::GetIntrsctnAttrs(int intrsctnIdx, int& num) const
+{
+	int first = m_cpCved->m_firstIntrsctnAttr[intrsctnIdx];
+	num = m_cpCved->m_firstIntrsctnAttr[intrsctnIdx + 1] - first;
+	return num > 0 ? &m_cpCved->m_intrsctnAttrs[first] : 0;
+} // end of GetIntrsctnAttrs
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SetDynObjPhase
+// 	Sets the phase of a dynamic object through CCved, which keeps a copy
+// 	of the phase of every dynamic object.
+//
+// Remarks:
+//
+// Arguments:
+// 	objId - identifier of the dynamic object
+// 	phase - the new phase, a cvEObjPhase
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCvedItem::SetDynObjPhase(int objId, int phase) const
+{
+	m_cpCved->SetDynObjPhase(objId, phase);
+} // end of SetDynObjPhase
 } // namespace CVED
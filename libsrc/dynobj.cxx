@@ -20,8 +20,8 @@
 using namespace CVED;
 */
 
-extern cvTFourWheelVeh	g_stateVector[cNUM_DYN_OBJS];
-extern cvTVehLin		g_vehLin[cNUM_DYN_OBJS];
+extern vector<cvTFourWheelVeh>	g_stateVector;
+extern vector<cvTVehLin>		g_vehLin;
 
 
 namespace CVED{
@@ -44,7 +44,7 @@ namespace CVED{
 CDynObj::~CDynObj()
 {
 	if( !m_readOnly )
-		m_pObj->phase = eDYING;
+		SetDynObjPhase( m_pObj->myId, eDYING );
 } // end of ~CDynObj
 
 
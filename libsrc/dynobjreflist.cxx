@@ -64,7 +64,7 @@ CCved::FillByRoadDynObjList( void )
 	if( !m_pSavedObjLoc ) 
 	{
 		// Allocate and initialize the data structure
-		m_pSavedObjLoc = new TSavedObjLoc[cNUM_DYN_OBJS];
+		m_pSavedObjLoc = new TSavedObjLoc[m_numDynObjs];
 		if( !m_pSavedObjLoc )
 		{
 			cerr << "CCved::FillByRoadDynObjList: Unable to allocate " << endl
@@ -74,7 +74,7 @@ CCved::FillByRoadDynObjList( void )
 		}
 		else
 		{
-            for (int i = 0; i < cNUM_DYN_OBJS; i++) {
+            for (int i = 0; i < m_numDynObjs; i++) {
                 m_pSavedObjLoc[i].boundBox.SetMin(CPoint2D());
                 m_pSavedObjLoc[i].boundBox.SetMax(CPoint2D());
                 m_pSavedObjLoc[i].pDynObjRefs = nullptr;
@@ -82,7 +82,7 @@ CCved::FillByRoadDynObjList( void )
                 m_pSavedObjLoc[i].valid = false;
             }
 			int i;
-			for( i = 0; i < cNUM_DYN_OBJS; ++i )
+			for( i = 0; i < m_numDynObjs; ++i )
 			{
 				m_pSavedObjLoc[i].pDynObjRefs =
 					new cvTDynObjRef[cCV_NUM_DOR_REPS];
@@ -253,7 +253,7 @@ CCved::FillByRoadDynObjList( void )
 	if( m_pSavedObjLoc )
 	{
 		TObjectPoolIdx objId;
-		for( objId = 0; objId < cNUM_DYN_OBJS; ++objId )
+		for( objId = 0; objId < m_numDynObjs; ++objId )
 		{
 			m_pSavedObjLoc[objId].same = false;
 			if( m_pSavedObjLoc[objId].valid )
@@ -606,6 +606,91 @@ CCved::FindDorIdx( TObjectPoolIdx objId )
 
 } // end of FindDorIdx
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns the entry of an object in the dynamic object
+//  reference list of a road.
+//
+// Remarks: The entries of an object can only occupy the slots given to
+//  it by FindDorIdx, so they are found without walking the list of the
+//  road.  Should the object overlap the road more than once, the entry
+//  with the smallest distance is returned, which is the one that comes
+//  first in the list.
+//
+// Arguments:
+// 	objId - Index of the object in the object pool.
+// 	roadId - Index of the road.
+//
+// Returns: a pointer to the entry, or 0 if the object is not on the road.
+//
+//////////////////////////////////////////////////////////////////////////////
+const cvTDynObjRef*
+CCved::GetRoadDynObjRef( int objId, int roadId ) const
+{
+	if( objId < 0 || objId >= cNUM_DYN_OBJS || !m_pDynObjRefPool )  return 0;
+
+	const cvTDynObjRef* pFound = 0;
+	int repItr;
+	for( repItr = 0; repItr < cCV_NUM_DOR_REPS; ++repItr )
+	{
+		const cvTDynObjRef* pDor =
+			&m_pDynObjRefPool[( repItr * cNUM_DYN_OBJS ) + ( objId + 1 )];
+		bool onRoad = (
+				pDor->terrain == eTERR_ROAD &&
+				pDor->objId == objId &&
+				pDor->roadId == roadId
+				);
+		if( onRoad && ( !pFound || pDor->distance < pFound->distance ) )
+		{
+			pFound = pDor;
+		}
+	}
+
+	return pFound;
+} // end of GetRoadDynObjRef
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Returns the entry of an object in the dynamic object
+//  reference list of an intersection.
+//
+// Remarks: See GetRoadDynObjRef.  Intersection lists are ordered by
+//  the corridor mask, so the entry with the smallest mask is returned
+//  if there is more than one.
+//
+// Arguments:
+// 	objId - Index of the object in the object pool.
+// 	intrsctnId - Index of the intersection.
+//
+// Returns: a pointer to the entry, or 0 if the object is not on the
+//  intersection.
+//
+//////////////////////////////////////////////////////////////////////////////
+const cvTDynObjRef*
+CCved::GetIntrsctnDynObjRef( int objId, int intrsctnId ) const
+{
+	if( objId < 0 || objId >= cNUM_DYN_OBJS || !m_pDynObjRefPool )  return 0;
+
+	const cvTDynObjRef* pFound = 0;
+	int repItr;
+	for( repItr = 0; repItr < cCV_NUM_DOR_REPS; ++repItr )
+	{
+		const cvTDynObjRef* pDor =
+			&m_pDynObjRefPool[( repItr * cNUM_DYN_OBJS ) + ( objId + 1 )];
+		bool onIntrsctn = (
+				pDor->terrain == eTERR_ISEC &&
+				pDor->objId == objId &&
+				pDor->intrsctnId == intrsctnId
+				);
+		if( onIntrsctn && ( !pFound || pDor->corridors < pFound->corridors ) )
+		{
+			pFound = pDor;
+		}
+	}
+
+	return pFound;
+} // end of GetIntrsctnDynObjRef
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description: Determines the proper position in the road reference 
@@ -993,7 +993,8 @@ CIntrsctn::GetBorder(CPolygon2D& poly) const
 // 	intersection.
 //
 // Remarks: This function will cause an assertion failure if it is called on 
-// 	an invalid CIntrsctn object.
+// 	an invalid CIntrsctn object.  The attributes read from the LRI file are
+// 	found through the index built by CCved::BuildAttrIdx.
 //
 // Arguments:
 //	id - identifier of an attribute type
@@ -1012,20 +1013,21 @@ CIntrsctn::QryAttr(int id,
 {
 	AssertValid();
 
+	// slots without an attribute have an id of 0
+	if (id == 0) 
+		return false;
+
 	cvTHeader	*pH   = static_cast<cvTHeader*>  (GetInst());
 	char        *pOfs = static_cast<char*>       (GetInst()) + 
 						pH->attrOfs;
-	cvTAttr		*pAttr = (reinterpret_cast<cvTAttr*>(pOfs)) +
-						m_pIntrs->attrIdx;
+	cvTAttr		*pPool = reinterpret_cast<cvTAttr*>(pOfs);
+	cvTAttr		*pAttr = pPool + m_pIntrs->attrIdx;
 	int i;
 
-	// For each attribute on the intersection
-	for (i = 0; i < m_pIntrs->numAttr; i++, pAttr++) {
+	// For each attribute created on the intersection at runtime
+	int numExtra = min(m_pIntrs->numAttr, cCV_LRI_INTRSCTN_ATTR_EXTRA);
+	for (i = 0; i < numExtra; i++, pAttr++) {
 
-		// take out those reserved for attributes created at runtime.
-		if (pAttr->myId == 0) 
-			continue;
- 
 		// If the attr ids match ...
 		if (pAttr->myId == id) {
 
@@ -1033,16 +1035,40 @@ CIntrsctn::QryAttr(int id,
 			gout << " Attribute ids match. " << endl;
 #endif
 
-
 			// Return the current attribute
 			attr = CAttr(GetCved(), pAttr);
 			return true;
 		}
 
-	} // For each attribute on the intersection
+	} // For each attribute created at runtime
+
+	// Look up the attributes from the LRI file in the index, and return
+	// the one stored first on the intersection
+	int num;
+	const int* pIdx = GetIntrsctnAttrs(GetId(), num);
+	const int* pLast = pIdx + num;
+	pIdx = lower_bound(pIdx, pLast, id,
+				[pPool](int attrIdx, int attrId) {
+					return pPool[attrIdx].myId < attrId;
+				});
+
+	int found = -1;
+	for (; pIdx != pLast && pPool[*pIdx].myId == id; pIdx++) {
+		if (found < 0 || *pIdx < found) 
+			found = *pIdx;
+	}
 
-	// No matching attribute found
-	return false;
+	if (found < 0) {
+		// No matching attribute found
+		return false;
+	}
+
+#ifdef DEBUG_QRY_ATTR2
+	gout << " Attribute ids match. " << endl;
+#endif
+
+	attr = CAttr(GetCved(), pPool + found);
+	return true;
 } // end of QryAttr
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,178 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: objlistbatch.cxx,v 1.1 $
+//
+// Author(s):
+// Date:
+//
+// Description: The implementation of CCved::BuildObjLists, which builds
+//  the object lists of many objects in one call.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include "cvedpub.h"
+#include "cvedstrc.h"
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+
+namespace CVED{
+
+// number of consecutive requests handed to a thread at a time
+static const int cOBJ_LIST_CHUNK = 8;
+
+// batches smaller than this are built on the calling thread
+static const int cMIN_PARALLEL_OBJ_LISTS = 32;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: BuildObjLists
+//  Builds the object lists requested by many objects, typically all the
+//  autonomous objects of a frame.
+//
+// Remarks: Each request is handled by the list builder of its kind
+//  (BuildFwdObjList, BuildBackObjList, BuildBackObjList2,
+//  BuildOncomingObjList or BuildApprchObjList), with the same results as
+//  calling that function directly.  The list of each request is cleared
+//  before it is built, so the requests can be kept from frame to frame
+//  to reuse the memory of their lists.
+//
+//  The requests are grouped by the road or intersection their position
+//  lies on and split among several threads, so that the threads read
+//  disjoint parts of the object reference lists.  The list builders only
+//  read the state of CCved, so this function must not be called while
+//  the maintainer is running.  If a list builder throws an exception,
+//  the remaining requests are abandoned and the first exception is
+//  thrown again on the calling thread.
+//
+// Arguments:
+//  requests - the requests; the objs member of each one receives the
+//   object list
+//  numThreads - (optional) the number of threads to use, including the
+//   calling thread; 0 uses one per processor
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::BuildObjLists(
+			vector<TObjListRequest>& requests,
+			int numThreads
+			)
+{
+	int numRequests = (int) requests.size();
+	if( numRequests == 0 )  return;
+
+	//
+	// Order the requests by the road or intersection they lie on.
+	//
+	vector< pair<int, int> > order( numRequests );
+	int i;
+	for( i = 0; i < numRequests; i++ )
+	{
+		const CRoadPos* pRoadPos = requests[i].pRoadPos;
+		int key = -1;
+		if( pRoadPos && pRoadPos->IsValid() )
+		{
+			if( pRoadPos->IsRoad() )
+				key = pRoadPos->GetRoad().GetId();
+			else
+				key = m_pHdr->roadCount + pRoadPos->GetIntrsctn().GetId();
+		}
+		order[i] = make_pair( key, i );
+	}
+	sort( order.begin(), order.end() );
+
+	if( numThreads <= 0 )
+	{
+		numThreads = (int) thread::hardware_concurrency();
+		if( numThreads <= 0 )  numThreads = 1;
+	}
+	int maxThreads = ( numRequests + cOBJ_LIST_CHUNK - 1 ) / cOBJ_LIST_CHUNK;
+	if( numThreads > maxThreads )  numThreads = maxThreads;
+	if( numRequests < cMIN_PARALLEL_OBJ_LISTS )  numThreads = 1;
+
+	atomic<int>		next( 0 );
+	atomic<bool>	failed( false );
+	exception_ptr	error;
+	mutex			errorLock;
+
+	auto work = [&]()
+	{
+		while( !failed )
+		{
+			int first = next.fetch_add( cOBJ_LIST_CHUNK );
+			if( first >= numRequests )  break;
+
+			int last = min( first + cOBJ_LIST_CHUNK, numRequests );
+			try
+			{
+				int r;
+				for( r = first; r < last; r++ )
+				{
+					TObjListRequest& req = requests[order[r].second];
+					req.objs.clear();
+					if( !req.pRoadPos )  continue;
+
+					switch( req.kind )
+					{
+					case eFWD_OBJ_LIST:
+						if( req.pPath )
+							BuildFwdObjList( req.ownerObjId, *req.pRoadPos,
+								*req.pPath, req.maxObjs, req.objMask,
+								req.objs );
+						break;
+					case eBACK_OBJ_LIST:
+						BuildBackObjList( req.ownerObjId, *req.pRoadPos,
+							req.maxObjs, req.objMask, req.objs );
+						break;
+					case eBACK_OBJ_LIST2:
+						if( req.pPrevRoad )
+							BuildBackObjList2( req.ownerObjId, *req.pRoadPos,
+								*req.pPrevRoad, req.maxObjs, req.objMask,
+								req.objs );
+						break;
+					case eONCOMING_OBJ_LIST:
+						if( req.pPath )
+							BuildOncomingObjList( req.ownerObjId,
+								*req.pRoadPos, *req.pPath, req.maxObjs,
+								req.objMask, req.objs );
+						break;
+					case eAPPRCH_OBJ_LIST:
+						if( req.pPath )
+							BuildApprchObjList( req.ownerObjId,
+								*req.pRoadPos, *req.pPath, req.maxObjs,
+								req.objMask, req.objs );
+						break;
+					}
+				}
+			}
+			catch( ... )
+			{
+				lock_guard<mutex> guard( errorLock );
+				if( !failed )  error = current_exception();
+				failed = true;
+			}
+		}
+	};
+
+	vector<thread> threads;
+	threads.reserve( numThreads - 1 );
+	for( i = 1; i < numThreads; i++ )
+	{
+		threads.push_back( thread( work ) );
+	}
+	work();
+	for( i = 0; i < (int) threads.size(); i++ )
+	{
+		threads[i].join();
+	}
+
+	if( error )  rethrow_exception( error );
+} // end of BuildObjLists
+
+} // namespace CVED
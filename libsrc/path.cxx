@@ -14,6 +14,7 @@
 
 #include "cvedpub.h"
 #include "cvedstrc.h"		// private CVED data structs
+#include <limits>
 
 #define PATH_DEBUG	0
 namespace CVED {
@@ -1852,183 +1853,9 @@ CPath::GetRoadPos(
 	if( curItr == m_points.end() )  return eCV_TRAVEL_NOT_FOUND;
 
 	endRoadPos = cStartRoadPos;
-	double distTraveled = endRoadPos.GetDistance();
-	
-	do 
-	{
-		//
-		// One these will be invalid, but there's no need to 
-		// check that right now.
-		//
-		CLane prevLane = endRoadPos.GetLane();
-		CCrdr prevCrdr = endRoadPos.GetCorridor();
-
-		endRoadPos.SetDistance( distTraveled );
-
-		//
-		// Travel to the end of the current CPathPoint, or to the 
-		// end of dist, whichever comes first.  If the current 
-		// point lies on a road
-		//
-		if( m_points[curItr].m_isRoad ) 
-		{
-			//
-			// Currently on a road coming from an intersection.
-			//
-			if( prevCrdr.IsValid() ) 
-			{
-				TLane* pCurLane = BindLane( prevCrdr.GetDstntnLnIdx() );
-
-				//
-				// Make sure that the previous corridor leads a lane
-				// on this road that is on list of valid lanes.
-				//
-				if( m_points[curItr].m_laneCrdrMask.test( pCurLane->laneNo ) ) 
-				{	
-					int prevCrdrId = ( prevCrdr.GetId() - 
-									   prevCrdr.GetIntrsctn().GetCrdrIdx()
-									   );
-					double crdrDist = endRoadPos.GetDistance( prevCrdrId );
-					CLane dstLane( GetCved(), pCurLane );
-					
-					endRoadPos.SetLane( dstLane );
-					endRoadPos.SetDistance( crdrDist );
-
-				}
-				else 
-				{
-					//
-					// Error, previous corridor does not connect to 
-					// the current lane.
-					//
-					return eCV_TRAVEL_ERROR;
-				}
-			}  // On a road, coming from an intersection.
-			
-			// else lane has already been set by cStartRoadPos
-
-			// 
-			// Compute distance to increment.
-			//
-			cvELnDir dir = m_points[curItr].GetLane().GetDirection();
-			if( dir == ePOS ) 
-			{
-				distTraveled = m_points[curItr].GetEndDist() - endRoadPos.GetDistance();
-			}
-			else 
-			{
-				distTraveled = endRoadPos.GetDistance() - m_points[curItr].GetEndDist();
-			}
-
-			if( dist > distTraveled ) 
-			{
-				curItr++;
-				pathPointIdx++;
-			}
-			else 
-			{
-				distTraveled = dist;
-			}
-				
-		} // If the current point lies on a road
-
-		else 
-		{
-			//
-			// In an intersection, coming from a road.
-			//
-			int crdrUsed = -1;
-			if( prevLane.IsValid() ) 
-			{
-				// 
-				// Make sure there's a corridor whose source lane = prevLane.
-				//
-				int prevLnId = prevLane.GetRoad().GetLaneIdx();
-				prevLnId += prevLane.GetRelativeId();
-
-
-				int crdrId = m_points[curItr].GetFirstLaneCrdrIdx();
-				TCrdr* pCrdr = BindCrdr( 
-									crdrId + 
-									m_points[curItr].m_intrsctn.GetCrdrIdx() 
-									);
-				for(
-					; 
-					( crdrId < cCV_MAX_CRDRS && crdrUsed < 0 );
-					crdrId++, pCrdr++
-					) 
-				{
-					if( m_points[curItr].m_laneCrdrMask.test( crdrId ) ) 
-					{
-						if( !strictConnectivity || pCrdr->srcLnIdx == prevLnId ) 
-						{
-							crdrUsed = crdrId;
-							// Sets corridor and intersection
-							endRoadPos.SetCorridor( 
-									CCrdr( GetCved(), pCrdr ), 
-									endRoadPos.GetDistance(), 
-									endRoadPos.GetOffset() 
-									);
-						}
-					}
-				}
-
-				if( crdrUsed < 0 ) 
-				{
-					// Error, no corridor on the path connects
-					// the current corridor(s) to the previous lane.
-					return eCV_TRAVEL_ERROR;
-				}
-
-			} // If coming from a road
-			// else crdr has already been set by cStartRoadPos
-			
-			if( crdrUsed < 0 ) 
-			{
-				crdrUsed = endRoadPos.GetCorridor().GetId() - 
-						   endRoadPos.GetIntrsctn().GetCrdrIdx();
-			}
-
-			// Compute distance to increment
-			distTraveled = (
-						m_points[curItr].GetEndDist( crdrUsed ) - 
-						endRoadPos.GetDistance()
-						);
-			bool allDistTraveled = dist <= distTraveled;
-			if( allDistTraveled )
-			{	
-				distTraveled = dist;
-			}
-			else 
-			{
-				curItr++;
-				pathPointIdx++;
-			}
-		} // Else if the current point lies on an intersection 
-
-		// Increment endRoadPos.distance
-		endRoadPos.IncrDistance( distTraveled );
-
-		// Decrement dist counter
-		dist -= distTraveled;
-
-		// Reset distTraveled for next iteration
-		if( curItr != m_points.end() ) 
-		{
-			distTraveled = m_points[curItr].GetStartDist();
-		}
-		else 
-		{
-			return eCV_TRAVEL_END_OF_PATH;
-		}
-		
-	} while( (dist > 0.0) && (curItr != m_points.end()) );
 
-	//
-	// If control reaches this point, then no error occurred and no 
-	// lane change is necessary.  Return OK.
-	//
-	return eCV_TRAVEL_OK;
+	int noCurLaneId = -1;
+	return Advance( dist, curItr, endRoadPos, strictConnectivity, noCurLaneId );
 
 } // end of GetRoadPos
 
@@ -2163,245 +1990,16 @@ CPath::Travel(
 	//
 	cTPathIterator curItr = FindPathPoint( cStart, m_pathPointIdx );
 	bool travelNotFound = curItr == m_points.end();
-	if( travelNotFound )  return eCV_TRAVEL_NOT_FOUND;
-
-	end = cStart;
-	double distTraveled = end.GetDistance();
-
-	//
-	// Execute this loop until the given distance has been traveled 
-	// or the end of the path has been reached.
-	//
-	do 
-	{
-		//
-		// One of these will be invalid, but there's no need to 
-		// check that right now.
-		//
-		CLane prevLane = end.GetLane();
-		CCrdr prevCrdr = end.GetCorridor();
-
-		end.SetDistance( distTraveled );
-
-		//
-		// Travel to the end of the current CPathPoint, or to the 
-		// end of dist, whichever comes first.  If the current 
-		// point lies on a road
-		//
-		if( m_points[curItr].m_isRoad )
-		{
-			// If coming from an intersection
-			if( prevCrdr.IsValid() ) 
-			{
-				int crdrId = (
-					prevCrdr.GetId() - prevCrdr.GetIntrsctn().GetCrdrIdx()
-					);
-		
-				TLane* pCurLane = BindLane( prevCrdr.GetDstntnLnIdx() );
-
-				//
-				// Make sure that dstLane of prevCrdr is on the list 
-				// of valid lanes.
-				//
-				if ( m_points[curItr].m_laneCrdrMask.test( pCurLane->laneNo ) ) 
-				{
-					double crdrDist = end.GetDistance( crdrId );
-					CLane dstLane( GetCved(), pCurLane );
-					// Sets lane and road
-					end.SetLane( dstLane );
-					end.SetDistance( crdrDist );
-				}
-				else 
-				{
-					//
-					// Error, previous corridor does not connect to 
-					// the current lane.
-					//
-					return eCV_TRAVEL_ERROR;
-				}
-			} // If coming from an intersection
-			// else lane has already been set by cStart
-
-			// 
-			// Compute the distance from here to the end of the road.
-			//
-			cvELnDir dir = m_points[curItr].GetLane().GetDirection();
-			if( dir == ePOS ) 
-			{
-				distTraveled = (
-					m_points[curItr].GetEndDist() - end.GetDistance()
-					);
-			}
-			else 
-			{
-				distTraveled = (
-					end.GetDistance() - m_points[curItr].GetEndDist()
-					);
-			}
-
-			bool allDistTraveled = dist <= distTraveled;
-			if( allDistTraveled )
-			{	
-				distTraveled = dist;
-			}
-			else 
-			{
-				curItr++;
-			}
-		} // If the current point lies on a road
-		else 
-		{
-			// 
-			// Coming from a road onto an intersection.
-			//
-			int crdrUsed = -1;
-			if( prevLane.IsValid() )
-			{
-				//
-				// Make sure there's a corridor whose source lane = prevLane.
-				//
-				int prevLnId = prevLane.GetRoad().GetLaneIdx();
-				bool noCurrentLane = m_curLaneId < 0;
-				if( noCurrentLane )
-				{
-					prevLnId += prevLane.GetRelativeId();
-				}
-				else
-				{
-					prevLnId += m_curLaneId;
-				}
-
-				int crdrId = m_points[curItr].GetFirstLaneCrdrIdx();
-				TCrdr* pCrdr = BindCrdr( 
-									crdrId + 
-									m_points[curItr].m_intrsctn.GetCrdrIdx()
-									);
-
-				for(
-					; 
-					( crdrId < cCV_MAX_CRDRS && crdrUsed < 0 );
-					crdrId++, pCrdr++
-					) 
-				{
-					if( m_points[curItr].m_laneCrdrMask.test( crdrId ) )
-					{
-						if( pCrdr->srcLnIdx == prevLnId ) 
-						{
-							crdrUsed = crdrId;
-							// Sets corridor and intersection
-							end.SetCorridor(
-									CCrdr( GetCved(), pCrdr ), 
-									end.GetDistance(), 
-									end.GetOffset()
-									);
-						}
-					}
-				}
-
-				if( crdrUsed < 0 ) 
-				{
-					bool tryAnotherSourceLane = prevLane.GetId() != m_curLaneId;
-					if( tryAnotherSourceLane )
-					{
-						//
-						// If we're in the middle of a lane change, then it makes sense
-						// to check connectivity against the other possible source lane.
-						//
-						int prevLnId = prevLane.GetRoad().GetLaneIdx();
-						prevLnId += prevLane.GetRelativeId();
-
-						int crdrId = m_points[curItr].GetFirstLaneCrdrIdx();
-						TCrdr* pCrdr = BindCrdr( 
-											crdrId + 
-											m_points[curItr].m_intrsctn.GetCrdrIdx()
-											);
-
-						for(
-							; 
-							( crdrId < cCV_MAX_CRDRS && crdrUsed < 0 );
-							crdrId++, pCrdr++
-							) 
-						{
-							if( m_points[curItr].m_laneCrdrMask.test( crdrId ) )
-							{
-								if( pCrdr->srcLnIdx == prevLnId ) 
-								{
-									crdrUsed = crdrId;
-									// Sets corridor and intersection
-									end.SetCorridor(
-											CCrdr( GetCved(), pCrdr ), 
-											end.GetDistance(), 
-											end.GetOffset()
-											);
-								}
-							}
-						}
-
-						if( crdrUsed < 0 )
-						{
-							// Error, no corridor on the path connects the current 
-							// corridor(s) to the previous lane.
-							return eCV_TRAVEL_ERROR;
-						}
-					}
-					else
-					{
-						// Error, no corridor on the path connects the current 
-						// corridor(s) to the previous lane.
-						return eCV_TRAVEL_ERROR;
-					}
-				}
-			} // If coming from a road
-			// else crdr has already been set by cStart
-			
-			if( crdrUsed < 0 )
-			{
-				crdrUsed = (
-					end.GetCorridor().GetId() - 
-					end.GetIntrsctn().GetCrdrIdx()
-					);
-			}
-
-			// Compute distance to increment
-			distTraveled = (
-				m_points[curItr].GetEndDist( crdrUsed ) - 
-				end.GetDistance()
-				);
-			bool allDistTraveled = dist <= distTraveled;
-			if( allDistTraveled )
-			{	
-				distTraveled = dist;
-			}
-			else 
-			{
-				curItr++;
-			}
-
-			//
-			// Reset current lane index, because it's invalid now that 
-			// we're on an intersection.
-			//
-			m_curLaneId = -1;
-
-		} // Else if the current point lies on an intersection 
-
-		// Increment end.distance
-		end.IncrDistance( distTraveled );
-
-		// Decrement dist counter
-		dist -= distTraveled;
-
-		// Reset distTraveled for next iteration
-		if( curItr != m_points.end() )
-		{
-			distTraveled = m_points[curItr].GetStartDist();
-		}
-		else 
-		{
-			return eCV_TRAVEL_END_OF_PATH;
-		}
-		
-	} while ( (dist > 0.0) && (curItr != m_points.end()) );
+	if( travelNotFound )  return eCV_TRAVEL_NOT_FOUND;
+
+	end = cStart;
+
+	//
+	// Travel until the given distance has been traveled or the end of 
+	// the path has been reached.
+	//
+	ETravelCode code = Advance( dist, curItr, end, true, m_curLaneId );
+	if( code != eCV_TRAVEL_OK )  return code;
 
 	//
 	// Figure out if a lane change is needed.
@@ -2631,9 +2229,291 @@ CPath::TravelBack(
 	if( travelNotFound )  return eCV_TRAVEL_NOT_FOUND;
 
 	pathTravelRoadPos = cInitial;
-	dist = fabs(dist);
-//	double distOnThisSegment = pathTravelRoadPos.GetDistance();
 
+	return Retreat( 
+				fabs( dist ), 
+				curItr, 
+				pathTravelRoadPos, 
+				strictConnectivity, 
+				m_curLaneId 
+				);
+
+} // end of TravelBack
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: (private) Moves a road position forward along the path.
+//
+// Remarks: This function holds the traversal shared by GetRoadPos and 
+//   both versions of Travel.  It starts from the path point 'curItr', 
+//   which must contain 'pos', and leaves 'curItr' on the path point that 
+//   contains the resulting position.  The road position is modified in 
+//   place, so traveling does not copy it or search the path.
+//
+// Arguments:
+//	dist - Distance to travel.
+//	curItr - (input/output) The path point that contains 'pos'.
+//	pos - (input/output) The road position to move.
+//	strictConnectivity - Indicates if a corridor must start at the 
+//          source lane to be taken.
+//	curLaneId - (input/output) The lane, relative to its road, whose 
+//          corridors are taken when leaving a road, or -1 to use the 
+//          lane of 'pos'.  It is reset to -1 once an intersection is 
+//          entered.
+//
+// Returns: eCV_TRAVEL_ERROR, eCV_TRAVEL_OK or eCV_TRAVEL_END_OF_PATH, as 
+//   described for GetRoadPos.
+//
+//////////////////////////////////////////////////////////////////////////////
+CPath::ETravelCode
+CPath::Advance(
+			double dist,
+			cTPathIterator& curItr,
+			CRoadPos& pos,
+			bool strictConnectivity,
+			int& curLaneId
+			) const
+{
+	double distTraveled = pos.GetDistance();
+
+	//
+	// Execute this loop until the given distance has been traveled 
+	// or the end of the path has been reached.
+	//
+	do 
+	{
+		//
+		// One of these will be invalid, but there's no need to 
+		// check that right now.
+		//
+		CLane prevLane = pos.GetLane();
+		CCrdr prevCrdr = pos.GetCorridor();
+
+		pos.SetDistance( distTraveled );
+
+		//
+		// Travel to the end of the current CPathPoint, or to the 
+		// end of dist, whichever comes first.  If the current 
+		// point lies on a road
+		//
+		if( m_points[curItr].m_isRoad )
+		{
+			// If coming from an intersection
+			if( prevCrdr.IsValid() ) 
+			{
+				int crdrId = (
+					prevCrdr.GetId() - prevCrdr.GetIntrsctn().GetCrdrIdx()
+					);
+		
+				TLane* pCurLane = BindLane( prevCrdr.GetDstntnLnIdx() );
+
+				//
+				// Make sure that dstLane of prevCrdr is on the list 
+				// of valid lanes.
+				//
+				if ( m_points[curItr].m_laneCrdrMask.test( pCurLane->laneNo ) ) 
+				{
+					double crdrDist = pos.GetDistance( crdrId );
+					CLane dstLane( GetCved(), pCurLane );
+					// Sets lane and road
+					pos.SetLane( dstLane );
+					pos.SetDistance( crdrDist );
+				}
+				else 
+				{
+					//
+					// Error, previous corridor does not connect to 
+					// the current lane.
+					//
+					return eCV_TRAVEL_ERROR;
+				}
+			} // If coming from an intersection
+			// else lane has already been set by the caller
+
+			// 
+			// Compute the distance from here to the end of the road.
+			//
+			cvELnDir dir = m_points[curItr].GetLane().GetDirection();
+			if( dir == ePOS ) 
+			{
+				distTraveled = (
+					m_points[curItr].GetEndDist() - pos.GetDistance()
+					);
+			}
+			else 
+			{
+				distTraveled = (
+					pos.GetDistance() - m_points[curItr].GetEndDist()
+					);
+			}
+
+			bool allDistTraveled = dist <= distTraveled;
+			if( allDistTraveled )
+			{	
+				distTraveled = dist;
+			}
+			else 
+			{
+				curItr++;
+			}
+		} // If the current point lies on a road
+		else 
+		{
+			// 
+			// Coming from a road onto an intersection.
+			//
+			int crdrUsed = -1;
+			if( prevLane.IsValid() )
+			{
+				//
+				// Make sure there's a corridor whose source lane = prevLane.
+				// If we're in the middle of a lane change, then it makes 
+				// sense to check connectivity against the other possible 
+				// source lane as well.
+				//
+				int firstLaneIdx = prevLane.GetRoad().GetLaneIdx();
+				int srcLnIdx[2];
+				int numSrcLn = 0;
+				bool noCurrentLane = curLaneId < 0;
+				if( noCurrentLane )
+				{
+					srcLnIdx[numSrcLn++] = firstLaneIdx + prevLane.GetRelativeId();
+				}
+				else
+				{
+					srcLnIdx[numSrcLn++] = firstLaneIdx + curLaneId;
+					if( prevLane.GetId() != curLaneId )
+					{
+						srcLnIdx[numSrcLn++] = firstLaneIdx + prevLane.GetRelativeId();
+					}
+				}
+
+				int i;
+				for( i = 0; i < numSrcLn && crdrUsed < 0; i++ )
+				{
+					int crdrId = m_points[curItr].GetFirstLaneCrdrIdx();
+					TCrdr* pCrdr = BindCrdr( 
+										crdrId + 
+										m_points[curItr].m_intrsctn.GetCrdrIdx()
+										);
+
+					for(
+						; 
+						( crdrId < cCV_MAX_CRDRS && crdrUsed < 0 );
+						crdrId++, pCrdr++
+						) 
+					{
+						if( m_points[curItr].m_laneCrdrMask.test( crdrId ) )
+						{
+							if( !strictConnectivity || pCrdr->srcLnIdx == srcLnIdx[i] ) 
+							{
+								crdrUsed = crdrId;
+								// Sets corridor and intersection
+								pos.SetCorridor(
+										CCrdr( GetCved(), pCrdr ), 
+										pos.GetDistance(), 
+										pos.GetOffset()
+										);
+							}
+						}
+					}
+				}
+
+				if( crdrUsed < 0 ) 
+				{
+					// Error, no corridor on the path connects the current 
+					// corridor(s) to the previous lane.
+					return eCV_TRAVEL_ERROR;
+				}
+			} // If coming from a road
+			// else crdr has already been set by the caller
+			
+			if( crdrUsed < 0 )
+			{
+				crdrUsed = (
+					pos.GetCorridor().GetId() - 
+					pos.GetIntrsctn().GetCrdrIdx()
+					);
+			}
+
+			// Compute distance to increment
+			distTraveled = (
+				m_points[curItr].GetEndDist( crdrUsed ) - 
+				pos.GetDistance()
+				);
+			bool allDistTraveled = dist <= distTraveled;
+			if( allDistTraveled )
+			{	
+				distTraveled = dist;
+			}
+			else 
+			{
+				curItr++;
+			}
+
+			//
+			// Reset current lane index, because it's invalid now that 
+			// we're on an intersection.
+			//
+			curLaneId = -1;
+
+		} // Else if the current point lies on an intersection 
+
+		// Increment pos.distance
+		pos.IncrDistance( distTraveled );
+
+		// Decrement dist counter
+		dist -= distTraveled;
+
+		// Reset distTraveled for next iteration
+		if( curItr != m_points.end() )
+		{
+			distTraveled = m_points[curItr].GetStartDist();
+		}
+		else 
+		{
+			return eCV_TRAVEL_END_OF_PATH;
+		}
+		
+	} while ( dist > 0.0 );
+
+	return eCV_TRAVEL_OK;
+
+} // end of Advance
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: (private) Moves a road position backwards along the path.
+//
+// Remarks: This function holds the traversal shared by both versions of 
+//   TravelBack.  It starts from the path point 'curItr', which must 
+//   contain 'pos', and leaves 'curItr' on the path point that contains 
+//   the resulting position.  The road position is modified in place.
+//
+// Arguments:
+//	dist - Distance to travel backwards; must not be negative.
+//	curItr - (input/output) The path point that contains 'pos'.
+//	pos - (input/output) The road position to move.
+//	strictConnectivity - Indicates if only the corridors that end at the 
+//          current lane may be taken.
+//	curLaneId - (input/output) The lane, relative to its road, whose 
+//          corridors are taken when entering an intersection, or -1 to 
+//          use the lane of 'pos'.  It is reset to -1 once an 
+//          intersection is entered.
+//
+// Returns: eCV_TRAVEL_ERROR, eCV_TRAVEL_OK or eCV_TRAVEL_END_OF_PATH, as 
+//   described for TravelBack.
+//
+//////////////////////////////////////////////////////////////////////////////
+CPath::ETravelCode
+CPath::Retreat(
+			double dist,
+			cTPathIterator& curItr,
+			CRoadPos& pos,
+			bool strictConnectivity,
+			int& curLaneId
+			) const
+{
 	//
 	// Execute this loop until the given distance has been traveled 
 	// or the end of the path has been reached.
@@ -2644,10 +2524,10 @@ CPath::TravelBack(
 		// One of these will be invalid, but there's no need to 
 		// check that right now.
 		//
-		CLane nextLane = pathTravelRoadPos.GetLane();
-		CCrdr nextCrdr = pathTravelRoadPos.GetCorridor();
+		CLane nextLane = pos.GetLane();
+		CCrdr nextCrdr = pos.GetCorridor();
 
-//		pathTravelRoadPos.SetDistance( distOnThisSegment );
+//		pos.SetDistance( distOnThisSegment );
 
 		//
 		// Travel to the end of the current CPathPoint, or to the 
@@ -2670,21 +2550,21 @@ CPath::TravelBack(
 				// of valid lanes.
 				if ( m_points[curItr].m_laneCrdrMask.test( pCurLane->laneNo ) ) 
 				{
-					double crdrDist = pathTravelRoadPos.GetDistance( crdrId );
+					double crdrDist = pos.GetDistance( crdrId );
 					CLane srcLane( GetCved(), pCurLane );
 					// Sets lane and road
-					bool result = pathTravelRoadPos.SetLane( srcLane );
+					bool result = pos.SetLane( srcLane );
 					if( !result )
 					{
 						return eCV_TRAVEL_ERROR;
 					}
-//					pathTravelRoadPos.SetDistance( crdrDist );
+//					pos.SetDistance( crdrDist );
 					CRoadPos::ETravelResult travelResult;
 					double endDist = m_points[curItr].GetEndDist();
 					if( srcLane.GetDirection() == ePOS )
-						travelResult = pathTravelRoadPos.SetDistance( endDist );
+						travelResult = pos.SetDistance( endDist );
 					else
-						travelResult = pathTravelRoadPos.SetDistance( 0.0 );
+						travelResult = pos.SetDistance( 0.0 );
 					if( travelResult == CRoadPos::ePAST_ROAD || travelResult == CRoadPos::eERROR )
 					{
 						return eCV_TRAVEL_ERROR;
@@ -2700,25 +2580,25 @@ CPath::TravelBack(
 					return eCV_TRAVEL_ERROR;
 				}
 			} // If coming from an intersection
-			// else lane has already been set by cInitial
+			// else lane has already been set by the caller
 			else
 			{
 				// Compute the distance from here to the end of the road.
 				cvELnDir dir = m_points[curItr].GetLane().GetDirection();
 				if( dir == ePOS ) 
 				{
-					segmentDist = pathTravelRoadPos.GetDistance();
+					segmentDist = pos.GetDistance();
 				}
 				else 
 				{
-					segmentDist = m_points[curItr].GetStartDist() - pathTravelRoadPos.GetDistance();
+					segmentDist = m_points[curItr].GetStartDist() - pos.GetDistance();
 				}
 			}
 
 			bool completedTravel = dist <= segmentDist;
 			if( completedTravel )
 			{	
-				CRoadPos::ETravelResult result = pathTravelRoadPos.DecrDistance( dist );
+				CRoadPos::ETravelResult result = pos.DecrDistance( dist );
 				if( result == CRoadPos::ePAST_ROAD || result == CRoadPos::eERROR )
 					return eCV_TRAVEL_ERROR;
 				else
@@ -2727,7 +2607,7 @@ CPath::TravelBack(
 			else 
 			{
 				dist -= segmentDist;
-				CRoadPos::ETravelResult result = pathTravelRoadPos.DecrDistance( segmentDist );
+				CRoadPos::ETravelResult result = pos.DecrDistance( segmentDist );
 				if( result == CRoadPos::ePAST_ROAD || result == CRoadPos::eERROR )
 				{
 					return eCV_TRAVEL_ERROR;
@@ -2754,14 +2634,14 @@ CPath::TravelBack(
 				// Make sure there's a corridor whose destination lane == nextLane.
 				//
 				int nextLnIdx = nextLane.GetRoad().GetLaneIdx();
-				bool noCurrentLane = m_curLaneId < 0;
+				bool noCurrentLane = curLaneId < 0;
 				if( noCurrentLane )
 				{
 					nextLnIdx += nextLane.GetRelativeId();
 				}
 				else
 				{
-					nextLnIdx += m_curLaneId;
+					nextLnIdx += curLaneId;
 				}
 
 				int crdrId = m_points[curItr].GetFirstLaneCrdrIdx();
@@ -2778,11 +2658,11 @@ CPath::TravelBack(
 							crdrUsed = crdrId;
 							double crdrDist = m_points[curItr].GetEndDist(crdrId);
 							// Sets corridor and intersection
-							pathTravelRoadPos.SetCorridor(
+							pos.SetCorridor(
 									CCrdr( GetCved(), pCrdr ), 
-//									pathTravelRoadPos.GetDistance(), 
+//									pos.GetDistance(), 
 									crdrDist,
-									pathTravelRoadPos.GetOffset()
+									pos.GetOffset()
 									);
 						}
 					}
@@ -2790,7 +2670,7 @@ CPath::TravelBack(
 
 				if( crdrUsed < 0 ) 
 				{
-					bool tryAnotherDstLane = (!strictConnectivity) && nextLane.GetId() != m_curLaneId;
+					bool tryAnotherDstLane = (!strictConnectivity) && nextLane.GetId() != curLaneId;
 					if( tryAnotherDstLane )
 					{
 						// If we're in the middle of a lane change, then it makes sense
@@ -2813,11 +2693,11 @@ CPath::TravelBack(
 									crdrUsed = crdrId;
 									double crdrDist = m_points[curItr].GetEndDist(crdrId);
 									// Sets corridor and intersection
-									pathTravelRoadPos.SetCorridor(
+									pos.SetCorridor(
 											CCrdr( GetCved(), pCrdr ), 
-//											pathTravelRoadPos.GetDistance(), 
+//											pos.GetDistance(), 
 											crdrDist,
-											pathTravelRoadPos.GetOffset()
+											pos.GetOffset()
 											);
 								}
 							}
@@ -2838,22 +2718,22 @@ CPath::TravelBack(
 					}
 				}
 			} // If coming from a road
-			// else crdr has already been set by cInitial
+			// else crdr has already been set by the caller
 			if( crdrUsed < 0 )
 			{
 				crdrUsed = (
-					pathTravelRoadPos.GetCorridor().GetId() - 
-					pathTravelRoadPos.GetIntrsctn().GetCrdrIdx()
+					pos.GetCorridor().GetId() - 
+					pos.GetIntrsctn().GetCrdrIdx()
 					);
 			}
 
 			// Compute distance to increment
-			segmentDist = pathTravelRoadPos.GetDistance();
+			segmentDist = pos.GetDistance();
 			bool allDistTraveled = dist <= segmentDist;
 			if( allDistTraveled )
 			{	
 //				distOnThisSegment = dist;
-				CRoadPos::ETravelResult result = pathTravelRoadPos.DecrDistance( dist );
+				CRoadPos::ETravelResult result = pos.DecrDistance( dist );
 				if( result == CRoadPos::ePAST_ROAD || result == CRoadPos::eERROR )
 					return eCV_TRAVEL_ERROR;
 				else
@@ -2872,12 +2752,12 @@ CPath::TravelBack(
 
 			// Reset current lane index, because it's invalid now that 
 			// we're on an intersection.
-			m_curLaneId = -1;
+			curLaneId = -1;
 
 		} // Else if the current point lies on an intersection 
 
-		// Decrement pathTravelRoadPos.distance
-//		pathTravelRoadPos.DecrDistance( distOnThisSegment );
+		// Decrement pos.distance
+//		pos.DecrDistance( distOnThisSegment );
 
 		// Decrement dist counter
 //		dist -= distOnThisSegment;
@@ -2890,7 +2770,164 @@ CPath::TravelBack(
 	//
 	return eCV_TRAVEL_OK;
 
-} // end of TravelBack
+} // end of Retreat
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SetCursor
+//   Places a path cursor at the given road position.
+//
+// Remarks: The path is searched for the path point that contains the road 
+//   position, starting from the path point the cursor was on, if any.  
+//   Once placed, the cursor can be moved with Travel and TravelBack 
+//   without searching the path again.
+//
+// Arguments:
+//	cRoadPos - A CRoadPos corresponding to a point along the current CPath.
+//	cursor - (output) The cursor to place.
+//
+// Returns: true if the road position lies on the path, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CPath::SetCursor( const CRoadPos& cRoadPos, CPathCursor& cursor ) const
+{
+	AssertValid();
+	if( !cRoadPos.IsValid() )  
+	{
+		cursor.m_pathPoint = -1;
+		return false;
+	}
+
+	int start = ( cursor.m_pathPoint >= 0 ) ? cursor.m_pathPoint : m_pathPointIdx;
+	cTPathIterator itr = FindPathPoint( cRoadPos, start );
+	if( itr == m_points.end() )
+	{
+		cursor.m_pathPoint = -1;
+		return false;
+	}
+
+	cursor.m_pathPoint = itr;
+	cursor.m_roadPos = cRoadPos;
+	return true;
+} // end of SetCursor
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Travel
+//   Moves a path cursor forward along the path.
+//
+// Remarks: This function gives the same results as GetRoadPos, but it 
+//   resumes from the path point of the cursor and moves the road position 
+//   of the cursor in place, so repeated calls neither search the path nor 
+//   allocate memory.  The path is only searched again if it was modified 
+//   so that the cursor no longer lies on its path point.
+//
+//	 Unlike the other version of Travel, this function does not use or 
+//   change the lane set by SwitchLane and does not report lane changes.
+//
+// Arguments:
+//	dist - Distance to travel.
+//	cursor - (input/output) A cursor placed by SetCursor.
+//  strictConnectivity - Indicates if this function should enforce
+//          connectivity between the road position and the corridors 
+//          along the path.
+//
+// Returns: eCV_TRAVEL_ERROR, eCV_TRAVEL_NOT_FOUND, eCV_TRAVEL_OK or 
+//   eCV_TRAVEL_END_OF_PATH, as described for GetRoadPos.  At the end of 
+//   the path, the cursor is left on the last path point.
+//
+//////////////////////////////////////////////////////////////////////////////
+CPath::ETravelCode
+CPath::Travel( double dist, CPathCursor& cursor, bool strictConnectivity ) const
+{
+	AssertValid();
+	if( !FindCursor( cursor ) )  return eCV_TRAVEL_NOT_FOUND;
+
+	int noCurLaneId = -1;
+	ETravelCode code = Advance( 
+						dist, 
+						cursor.m_pathPoint, 
+						cursor.m_roadPos, 
+						strictConnectivity, 
+						noCurLaneId 
+						);
+	if( cursor.m_pathPoint == m_points.end() )  cursor.m_pathPoint--;
+
+	return code;
+} // end of Travel
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: TravelBack
+//   Moves a path cursor backwards along the path.
+//
+// Remarks: This function gives the same results as the other version of 
+//   TravelBack, except that it does not use or change the lane set by 
+//   SwitchLane.  It resumes from the path point of the cursor and moves 
+//   the road position of the cursor in place.
+//
+// Arguments:
+//	dist - Distance to travel backwards; negative distances are 'fabs'ed.
+//	cursor - (input/output) A cursor placed by SetCursor.
+//  strictConnectivity - Indicates if only the corridors that end at the 
+//          current lane may be taken.
+//
+// Returns: eCV_TRAVEL_ERROR, eCV_TRAVEL_NOT_FOUND, eCV_TRAVEL_OK or 
+//   eCV_TRAVEL_END_OF_PATH, as described for TravelBack.
+//
+//////////////////////////////////////////////////////////////////////////////
+CPath::ETravelCode
+CPath::TravelBack( double dist, CPathCursor& cursor, bool strictConnectivity ) const
+{
+	AssertValid();
+	if( !FindCursor( cursor ) )  return eCV_TRAVEL_NOT_FOUND;
+
+	int noCurLaneId = -1;
+	return Retreat( 
+				fabs( dist ), 
+				cursor.m_pathPoint, 
+				cursor.m_roadPos, 
+				strictConnectivity, 
+				noCurLaneId 
+				);
+} // end of TravelBack
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: (private) Makes sure that a cursor lies on its path point.
+//
+// Remarks: The path point of the cursor is checked first; the path is 
+//   only searched if the path was modified since the cursor was placed.
+//
+// Arguments:
+//	cursor - (input/output) The cursor to check.
+//
+// Returns: true if the road position of the cursor lies on the path.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CPath::FindCursor( CPathCursor& cursor ) const
+{
+	if( !cursor.m_roadPos.IsValid() )  return false;
+
+	bool onPathPoint = ( 
+				cursor.m_pathPoint >= m_points.begin() &&
+				cursor.m_pathPoint < m_points.end() &&
+				m_points[cursor.m_pathPoint].Contains( cursor.m_roadPos )
+				);
+	if( onPathPoint )  return true;
+
+	int start = 0;
+	cursor.m_pathPoint = FindPathPoint( cursor.m_roadPos, start );
+	if( cursor.m_pathPoint == m_points.end() )
+	{
+		cursor.m_pathPoint = -1;
+		return false;
+	}
+
+	return true;
+} // end of FindCursor
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -3217,128 +3254,8 @@ CPath::GetNextHldOfs( const CRoadPos& cPos, int* crdrIdOut , int lookahead) cons
     }
 	*/
 
-
-	CIntrsctn intr;
-	vector<CHldOfs> hldOfsList;
-	TCrdrVec crdrVec;
-
-	// get the next or current intersection
-	intr = cPos.GetNextIntrsctn();
-	if (!intr.IsValid()){
-		return CHldOfs();
-	}
-
-	CLane lane = cPos.GetLane();
-	if (cPos.IsRoad() && !lane.IsValid()){
-		return CHldOfs();
-	}
-
-	int n = 0;
-	if (lookahead < 1){
-		lookahead = 1;
-	}
-	
-	// check if point is on a road or intersection
-	// may return the wrong haltline if a point lies on two different corridors
-	if (!cPos.IsRoad()){
-		while( n < lookahead ){
-			// check if any corridors contain the point and if so, return the haltline
-			intr.GetAllCrdrs(crdrVec);
-
-			// no corridors in intersection
-			if (crdrVec.size() == 0){
-				return CHldOfs();
-			}
-
-			for(int i=0; i<crdrVec.size(); i++){
-				if (cPos.HasCorridor(crdrVec[i].GetRelativeId())){
-					crdrVec[i].GetAllHldOfs(hldOfsList);
-					if (hldOfsList.size() > 0){
-						if (crdrIdOut){
-							*crdrIdOut = crdrVec[i].GetId();
-						}
-						return *hldOfsList.begin();
-					}
-				}
-			}
-
-			// no haltlines found
-			int crdr = -1;
-			for(int i=0; i<crdrVec.size(); i++){
-				if (cPos.HasCorridor(crdrVec[i].GetRelativeId())){
-					if (crdr == -1){
-						crdr = i;
-					}
-					if (crdrVec[i].GetCrdrDirection() == CCrdr::eSTRAIGHT){
-						crdr = i;
-						break;
-					}
-				}
-			}
-
-			// no corridors found
-			if (crdr == -1){
-				return CHldOfs();
-			}
-
-			// find the next lane & intersection
-			lane = crdrVec[crdr].GetDstntnLn();
-			if (!lane.IsValid()){
-				return CHldOfs();
-			}
-			intr = lane.GetNextIntrsctn();
-			if (!intr.IsValid()){
-				return CHldOfs();
-			}
-
-			n++;
-		}
-	} else {
-		// query the next few intersections for haltlines
-		while(n < lookahead ){
-			// get all corridors connected to the lane given by the position
-			intr.GetCrdrsStartingFrom(lane, crdrVec);
-
-			//no corridors in intersection
-			if (crdrVec.size() == 0){
-				return CHldOfs();
-			}
-
-			for(int i=0; i<crdrVec.size(); i++){
-				crdrVec[i].GetAllHldOfs(hldOfsList);
-				if (hldOfsList.size() > 0){
-					if (crdrIdOut){
-						*crdrIdOut = crdrVec[i].GetId();
-					}
-					return *hldOfsList.begin();
-				}
-			}
-
-			// no haltlines found, look for straight corridor so we can find the next intersection
-			int crdr = 0;
-			for(int i=0; i<crdrVec.size(); i++){
-				if (crdrVec[i].GetCrdrDirection() == CCrdr::eSTRAIGHT){
-					crdr = i;
-					break;
-				}
-			}
-
-			// find the next lane & intersection
-			lane = crdrVec[crdr].GetDstntnLn();
-			if (!lane.IsValid()){
-				return CHldOfs();
-			}
-			intr = lane.GetNextIntrsctn();
-			if (!intr.IsValid()){
-				return CHldOfs();
-			}
-
-			n++;
-		}
-	}
-
-	// failed to find a suitable corridor with a haltline
-	return CHldOfs();
+	// the path is not used; the halt line is looked up from the position
+	return cPos.GetNextHldOfs( crdrIdOut, lookahead );
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -3400,133 +3317,8 @@ CPath::GetDistToNextHldOfs( const CRoadPos& cPos , int lookahead ) const{
     return -1;
 	*/
 
-	CIntrsctn intr;
-	vector<CHldOfs> hldOfsList;
-	TCrdrVec crdrVec;
-
-	// get the next or current intersection
-	intr = cPos.GetNextIntrsctn();
-	if (!intr.IsValid()){
-		return -1;
-	}
-
-	CLane lane = cPos.GetLane();
-	if (cPos.IsRoad() && !lane.IsValid()){
-		return -1;
-	}
-
-	int n = 0;
-	if (lookahead < 1){
-		lookahead = 1;
-	}
-
-	double dist = 0;
-	
-	// check if point is on a road or intersection
-	// may return the wrong haltline if a point lies on two different corridors
-	if (!cPos.IsRoad()){
-		// query the next few intersections for haltlines
-		while( n < lookahead ){
-			// check if any corridors contain the point and if so, return the haltline
-			intr.GetAllCrdrs(crdrVec);
-
-			if (crdrVec.size() == 0){
-				return -1;
-			}
-
-			for(int i=0; i<crdrVec.size(); i++){
-				if (cPos.HasCorridor(crdrVec[i].GetRelativeId())){
-					crdrVec[i].GetAllHldOfs(hldOfsList);
-					if (hldOfsList.size() > 0){
-						if (n == 0){
-							return hldOfsList.begin()->GetDistance() - cPos.GetDistanceOnLane(crdrVec[i].GetRelativeId());
-						} else {
-							return hldOfsList.begin()->GetDistance() + dist;
-						}
-					}
-				}
-			}
-
-			// no haltlines found
-			int crdr = -1;
-			for(int i=0; i<crdrVec.size(); i++){
-				if (cPos.HasCorridor(crdrVec[i].GetRelativeId())){
-					if (crdr == -1){
-						crdr = i;
-					}
-					if (crdrVec[i].GetCrdrDirection() == CCrdr::eSTRAIGHT){
-						crdr = i;
-						break;
-					}
-				}
-			}
-
-			// no corridors found
-			if (crdr == -1){
-				return -1;
-			}
-
-			// find the next lane & intersection
-			lane = crdrVec[crdr].GetDstntnLn();
-			if (!lane.IsValid()){
-				return -1;
-			}
-			intr = lane.GetNextIntrsctn();
-			if (!intr.IsValid()){
-				return -1;
-			}
-
-			if (n == 0){
-				dist += lane.GetRoad().GetLinearLength() + crdrVec[crdr].GetLength() - cPos.GetDistanceOnLane(crdrVec[crdr].GetRelativeId());
-			} else {
-				dist += lane.GetRoad().GetLinearLength() + crdrVec[crdr].GetLength();
-			}
-			n++;
-		}
-	} else {
-		// query the next few intersections for haltlines
-		dist += cPos.GetRoad().GetLinearLength() - cPos.GetDistanceOnLane();
-		while(n < lookahead){
-			// get all corridors connected to the lane given by the position
-			intr.GetCrdrsStartingFrom(lane, crdrVec);
-
-			// no corridors in intersection
-			if (crdrVec.size() == 0){
-				return -1;
-			}
-
-			for(int i=0; i<crdrVec.size(); i++){
-				crdrVec[i].GetAllHldOfs(hldOfsList);
-				if (hldOfsList.size() > 0){
-					return hldOfsList.begin()->GetDistance() + dist;
-				}
-			}
-
-			// no haltlines found, look for straight corridor so we can find the next intersection
-			int crdr = 0;
-			for(int i=0; i<crdrVec.size(); i++){
-				if (crdrVec[i].GetCrdrDirection() == CCrdr::eSTRAIGHT){
-					crdr = i;
-					break;
-				}
-			}
-			// find the next lane & intersection
-			lane = crdrVec[crdr].GetDstntnLn();
-			if (!lane.IsValid()){
-				return -1;
-			}
-			intr = lane.GetNextIntrsctn();
-			if (!intr.IsValid()){
-				return -1;
-			}
-
-			dist += lane.GetRoad().GetLinearLength() + crdrVec[crdr].GetLength();
-			n++;
-		}
-	}
-
-	// failed to find a suitable corridor with a haltline
-	return -1;
+	// the path is not used; the halt line is looked up from the position
+	return cPos.GetDistToNextHldOfs( lookahead );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -4128,23 +3920,18 @@ CPath::GetOncomingPath(
 		
 	}
 	
+	if( !closestOppositeDirLn.IsValid() )
+	{
+		return 0;
+	}
+
 	vector<CCrdr> desiredCrdrs;
 
-	// Hold all the corridors in the proper intersetion in a vector.
-	// Find only those corridors that are approaching the closest opposite
-	// direction lane and hold them in another vector.
+	// Find only those corridors of the proper intersection that are
+	// approaching the closest opposite direction lane and hold them
+	// in a vector.
 	//
-	vector<CCrdr> allCrdrs;
-	intrsctn.GetAllCrdrs( allCrdrs );	
-	vector<CCrdr>::iterator i;
-	for ( i= allCrdrs.begin(); i != allCrdrs.end(); i++ )
-	{
-		CCrdr aCrdr = *i;
-		if( aCrdr.GetDstntnLn() == closestOppositeDirLn )
-		{
-			desiredCrdrs.push_back( aCrdr );
-		}
-	}
+	GetCrdrsIntoLane( intrsctn, closestOppositeDirLn, desiredCrdrs );
 
 	//
 	// The number of corridors in the desired corridors vector is the 
@@ -4311,47 +4098,44 @@ CPath::GetApproachingPaths(
 		currLane = cStartRoadPos.GetCorridor().GetDstntnLn();
 	}
 	int numLanes = road.GetNumLanes();	
-	/*static*/ vector<cvTLane> sameDirLanes;
-	/*if ( sameDirLanes.capacity() <= 0 )*/  sameDirLanes.reserve( 10 );
-	sameDirLanes.clear();
 	int firstLaneIdx = road.GetLaneIdx();
-	cvTLane* pLane;
+	cvELnDir currLaneDir = currLane.GetDirection();
+
+	//
+	// Collect the corridors of the proper intersection that lead into
+	// the lanes that are running in the same direction as the current
+	// lane.  They are kept in the order of the corridors of the 
+	// intersection.
+	//
+	/*static*/ vector<int> desiredCrdrIds;
+	desiredCrdrIds.clear();
+	int intrsctnId = intrsctn.GetId();
 	for( int k = 0; k <= (numLanes - 1); k++ )
 	{
-		pLane = BindLane( firstLaneIdx + k );
-		if( pLane->direction == currLane.GetDirection() )
+		if( BindLane( firstLaneIdx + k )->direction != currLaneDir )
+		{
+			continue;
+		}
+
+		int numCrdrs;
+		const int* pCrdrIds = GetDstLnCrdrs( firstLaneIdx + k, numCrdrs );
+		for( int c = 0; c < numCrdrs; c++ )
 		{
-			sameDirLanes.push_back( *pLane );
+			if( (int)BindCrdr( pCrdrIds[c] )->intrsctnId == intrsctnId )
+			{
+				desiredCrdrIds.push_back( pCrdrIds[c] );
+			}
 		}
 	}
+	sort( desiredCrdrIds.begin(), desiredCrdrIds.end() );
 
-	//
-	// Hold all the corridors of the proper intersection in a vector.
-	// Compare all the corridor's destination lanes 
-	// with all the lanes that are running in the same direction 
-	// as the current lane to see if they are equal. If so,
-	// hold these corridors in another vector.
-	//
-	vector<CCrdr> allCrdrs;
-	intrsctn.GetAllCrdrs( allCrdrs );
 	/*static*/ vector<CCrdr> desiredCrdrs;
-	/*if ( desiredCrdrs.capacity() <= 0 )*/  sameDirLanes.reserve( 20 );
 	desiredCrdrs.clear();
-	vector<CCrdr>::iterator i;
-	for ( i= allCrdrs.begin(); i != allCrdrs.end(); i++ )
+	desiredCrdrs.reserve( desiredCrdrIds.size() );
+	vector<int>::const_iterator i;
+	for ( i = desiredCrdrIds.begin(); i != desiredCrdrIds.end(); i++ )
 	{
-		CCrdr aCrdr = *i;
-		vector<cvTLane>::iterator j;
-		for ( j = sameDirLanes.begin(); j != sameDirLanes.end(); j++ )
-		{
-			cvTLane dstntnLane = *j;
-			if( aCrdr.GetDstntnLn( ).GetRoad().GetId() == dstntnLane.roadId &&
-				aCrdr.GetDstntnLn( ).GetDirection() == dstntnLane.direction )
-			{
-				desiredCrdrs.push_back( aCrdr );
-				break;
-			}
-		}		
+		desiredCrdrs.push_back( CCrdr( GetCved(), *i ) );
 	}
 		
 	//
@@ -4470,22 +4254,10 @@ CPath::GetApproachingPathsLane(
 
 	vector<CCrdr> desiredCrdrs;
 	// 
-	// Use a vector to hold all the corridors in the intersection.
-	// Iterate the vector to compare if any of the corridors'
-	// destintion lane is the same lane where the cStartRoadPos
-	// is located. If so, put these corridors in another vector.
+	// Put the corridors of the intersection whose destination lane
+	// is the same lane where the cStartRoadPos is located in a vector.
 	//
-	vector<CCrdr> allCrdrs;
-	intrsctn.GetAllCrdrs( allCrdrs );	
-	vector<CCrdr>::iterator i;
-	for ( i= allCrdrs.begin(); i != allCrdrs.end(); i++ )
-	{
-		CCrdr aCrdr = *i;
-		if( aCrdr.GetDstntnLn() == currLane )
-		{
-			desiredCrdrs.push_back( aCrdr );
-		}
-	}
+	GetCrdrsIntoLane( intrsctn, currLane, desiredCrdrs );
 	
 	//
 	// Have found all the corridors that are approaching the lane of the 
@@ -4525,6 +4297,43 @@ CPath::GetApproachingPathsLane(
 	return (int) paths.size();
 } // end of GetApproachingPathsLane
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetCrdrsIntoLane
+//	Collects the corridors of an intersection that lead into a lane.
+//
+// Remarks: The corridors are looked up in the table of corridors by
+//	destination lane that CCved builds when the LRI file is loaded, so
+//	the other corridors of the intersection are not visited.
+//
+// Arguments:
+//	cIntrsctn - (Input) The intersection.
+//	cLane - (Input) The destination lane.
+//	crdrs - (Output) The corridors, in the order of the corridors of the
+//		intersection.  Note: the vector is not cleared.
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CPath::GetCrdrsIntoLane(
+			const CIntrsctn& cIntrsctn,
+			const CLane& cLane,
+			vector<CCrdr>& crdrs
+			) const
+{
+	int intrsctnId = cIntrsctn.GetId();
+	int numCrdrs;
+	const int* pCrdrIds = GetDstLnCrdrs( cLane.GetIndex(), numCrdrs );
+	for( int i = 0; i < numCrdrs; i++ )
+	{
+		if( (int)BindCrdr( pCrdrIds[i] )->intrsctnId == intrsctnId )
+		{
+			crdrs.push_back( CCrdr( GetCved(), pCrdrIds[i] ) );
+		}
+	}
+} // end of GetCrdrsIntoLane
+
 ///////////////////////////////////////////////////////////////////////////
 double
 CPath::GetNextTurnAngle( const CRoadPos& cRoadPos ) const
@@ -4795,18 +4604,10 @@ CPath::FindPathPoint( const CRoadPos& cRoadPos, int& start ) const
 CPath::cTPathIterator
 CPath::FindPathPoint( int idx ) const
 {
-	cTPathIterator itr;
-	int curIdx;
+	// path iterators are indexes, so there is no need to walk the path
+	if( idx < 0 || idx >= m_points.size() )  return m_points.end();
 
-	for( 
-		itr = m_points.begin(), curIdx = 0; 
-		itr != m_points.end(); 
-		itr ++, curIdx++
-		) 
-	{
-		if( curIdx == idx )  return itr;
-	}
-	return itr;
+	return m_points.begin() + idx;
 } // end of FindCurPathPoint
 
 //////////////////////////////////////////////////////////////////////////////
@@ -5256,36 +5057,24 @@ CPath::GetLaneIdFromRoad(
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description: CalculateRoute
-//  Creates a tree of all possible directions the driver can take and 
-//	calculates the first or shortest route between two points
-//	Uses a breadth-first search and does not use greedy algorithms
+//  Calculates the route with the fewest corridors, or the shortest route,
+//	between two points.
 //
 // Remarks: both the start and the destination must be on a road. This method
 //	differs from the method in roadpos.cxx in that it stores points in m_points
 //	as path points rather than in a vector of TRouteInfo.
 //
-// Remarks on optimizations: The first optimization implemented was to
-//	keep track of how many times a route traveled away from the destination
-//	point in a row. If the route travels away from the destination point
-//	too many times, then the route finder will stop expanding upon that
-//	route. In order to implement this, each node contains a counter that
-//	increments every time a route travels away from the destination point
-//	and resets every time a route travels towards the destination point. 
-//	Whether or not the route travels towards or away from the destination 
-//	point is decided by computing the linear distance to the destination
-//	and comparing it with the previous linear distance to the destination.
-//	This optimization has a significant effect on certain routes where there
-//	are few paths that lead to the destination. In some cases, the route
-//	calculation time dropped from several seconds to almost instantaneous.
-//
-//	The second optimization implemented deals with routes that contain
-//	many nodes. As the number of nodes continues to grow, the calculation
-//	time increases exponentially. The optimization periodically checks
-//	the route tree when it becomes large and eliminates all nodes except
-//	the closest several nodes. This implementation uses the functions
-//	GetAllNodesAtLevel() and DiscardFarNodes(). It has no noticeable
-//	effect on routes with a small number of nodes, but dramatically
-//	decreases the calculation time of routes with 18+ nodes.
+//	The route is found by searching the road graph built by CCved when the
+//	LRI file is loaded (see CRouteGraph).  Each node of the graph is a road
+//	traveled in one direction and each edge a driving corridor.  When
+//	looking for the shortest route, an A* search with the straight line
+//	distance to the destination as the heuristic is used; otherwise a
+//	breadth first search returns the route with the fewest corridors.
+//	A shortest route without a limit on the number of corridors is found
+//	with the route hierarchy stored in the LRI file when it was compiled
+//	with lricc -routes, which is much faster for long routes.
+//	The path contains the start, a point 0.1 ft into each road that is left
+//	through a corridor, and the destination.
 //
 // Arguments:
 //	start - initial point
@@ -5293,8 +5082,8 @@ CPath::GetLaneIdFromRoad(
 //	totalDist - total distance of the route in feet
 //	clear - (default = false) flag denoting whether or not to clear the current path
 //	shortest - (default = false), flag to find the shortest route
-//		note: finding shortest route takes significantly longer for complex routes
-//	maxHeight - (default = 25), maximum height of the tree before giving up
+//	maxHeight - (default = 25), maximum number of corridors in the route, or
+//		0 for no limit
 //
 // Returns: true if route was found, otherwise false
 //
@@ -5317,29 +5106,6 @@ CPath::CalculateRoute(CRoadPos& start, CRoadPos& end, double& totalDist, bool cl
 		return false;
 	}
 
-	// used to store multiple valid routes if searching for shortest route
-	vector< vector<CPathPoint> > routes;
-	vector<double> routeDistances;
-	
-	// set up head node
-	TRouteNode head;
-	head.head = true;
-	head.found = true;	// head always included in route
-	head.searched = false;
-	head.srcRoadIdx = -1; // head has no source
-	head.srcCrdrId = -1; 
-	head.srcLaneId = -1;
-	head.roadIdx = road.GetId();
-	head.roadDir = start.GetLane().GetDirection();
-	head.length = 0; // length is based on source lane and corridor
-
-	CPoint3D initLoc = start.GetVeryBestXYZ();
-	CPoint3D destLoc = end.GetVeryBestXYZ();
-	head.linearDistSquared = (initLoc.m_x - destLoc.m_x) * (initLoc.m_x - destLoc.m_x) +
-							 (initLoc.m_y - destLoc.m_y) * (initLoc.m_y - destLoc.m_y) +
-							 (initLoc.m_z - destLoc.m_z) * (initLoc.m_z - destLoc.m_z) ;
-	head.awayNodes = 0;
-
 	// trivial case where initial and destination are on the same road
 	// and the destination is ahead of the initial position
 	if (road.GetId() == dest.GetId() && start.GetLane().GetDirection() == end.GetLane().GetDirection() && start.GetDistanceOnLane() < end.GetDistanceOnLane()) {
@@ -5352,156 +5118,83 @@ CPath::CalculateRoute(CRoadPos& start, CRoadPos& end, double& totalDist, bool cl
 		m_points.push_back(CPathPoint(end));
 		return true;
 	}
-	
-	// the maxAway counter is the max number of times a route can move away from the destination point in a row
-	for(int maxAway=1; maxAway<=8; maxAway*=2) {
-		// resets the tree if a route was not found
-		head.children.clear();
-		head.searched = false;
-
-		totalDist = 0; // keeps track of total route distance
-		int height = 1;	// height of the route tree
-		bool done = false; // keeps track of whether a route or set of routes has been found
-
-		while(height <= maxHeight){
-			// check if a valid route was found
-			if (GetRouteChildren(road.GetId(), start.GetLane().GetDirection(), end, height, &head , maxAway)){
-
-				TRouteNode* ptr = &head;
-				vector<CPathPoint> temp;
-
-				// the first node's length is calculated differently from all other nodes
-				bool first = true;
-
-				if (clear) {
-					m_points.clear();
-					if (!shortest) {
-						m_points.push_back(CPathPoint(start));
-					} else {
-						ptr->found = false;
-						temp.push_back(CPathPoint(start));
-					}
-				}
-					
-				// store route data
-				while(true) {
-					// get the first node in the route (after the head)
-					bool found = false;
-					for(int i=0; i<ptr->children.size(); i++) {
-						if (ptr->children[i].found) {
-							ptr = &ptr->children[i];
-							found = true;
-							break;
-						}
-					}
-
-					if (found) {
-						// add segment length to the total distance
-						totalDist += first ? ptr->length - start.GetDistanceOnLane() : ptr->length;
-						
-
-						CRoad road(GetCved(), ptr->srcRoadIdx);
-						// specified distance of 0.1 ft to add some padding
-						CRoadPos pos(road, ptr->srcCrdrId, 0.1, 0);
-
-						// if appending, do not add the first node
-						if (clear || !first) {
-							if (!shortest) {
-								m_points.push_back(CPathPoint(pos));
-							} else {
-								ptr->found = false;
-								temp.push_back(CPathPoint(pos));
-							}
-						}
-
-						first = false;
-
-						// need to change a few things for the last node
-						if (ptr->children.size() == 0) {
-							totalDist += end.GetDistanceOnLane();
-						
-							if (!shortest) {
-								m_points.push_back(CPathPoint(end));
-							} else {
-								temp.push_back(CPathPoint(end));
-								routes.push_back(temp);
-								routeDistances.push_back(totalDist);
-
-								// reset distance tracker
-								totalDist = 0;
-
-								// since a route has been found, we don't have to search much more
-								// this is not strictly necessary, but it will speed up things by a lot
-								// this is used only if calculating the shortest route
-								if (maxHeight > height + 2 && height < 10) {
-									maxHeight = height + 2;
-								} else if (maxHeight > height + 1 && height < 15) {
-									maxHeight = height + 1;
-								} else {
-									maxHeight = height;
-								}
-							}
-							break;
-						}
-					} else {
-						// should not happen--occurs when GetRouteChildren() returns true & either the route was constructed improperly or there is no route
-						// add a breakpoint to debug GetRouteChildren()
-						return false;
-					}
 
-					first = false;
-				}
+	const CRouteGraph& cGraph = GetCved().GetRouteGraph();
+	vector<CRouteGraph::TEdge> route;
+	bool found;
+	if (shortest && maxHeight <= 0) {
+		found = cGraph.FindShortestRoute(
+				road.GetId(),
+				start.GetLane().GetDirection(),
+				dest.GetId(),
+				end.GetLane().GetDirection(),
+				route);
+	}
+	else {
+		found = cGraph.FindRoute(
+				road.GetId(),
+				start.GetLane().GetDirection(),
+				dest.GetId(),
+				end.GetLane().GetDirection(),
+				shortest,
+				maxHeight > 0 ? maxHeight : numeric_limits<int>::max(),
+				route);
+	}
+	if (!found) {
+		return false;
+	}
 
-				// if not searching for the shortest route, return the output
-				if (!shortest) {
-					return true;
-				} else {
-					// otherwise we need to find if there are any other routes with the same number of segments
-					// however, we do not need to remake the tree with a higher max away node limit
-					done = true; 
-					continue; 
-				}
+	if (clear) {
+		m_points.clear();
+		m_points.push_back(CPathPoint(start));
+	}
 
-			}
+	// the first segment starts at the initial position rather than
+	// at the beginning of the road
+	totalDist = 0;
+	for (int i = 0; i < (int)route.size(); i++) {
+		const CRouteGraph::TEdge& cEdge = route[i];
 
-			// no route found; increment the height of the tree
-			height++;
+		totalDist += (i == 0) ? cEdge.length - start.GetDistanceOnLane() : cEdge.length;
 
-			// periodically scan the tree for nodes that are too far away from the destination and discard these nodes
-			if (height % 8 == 0) {
-				std::vector<TRouteNode*> nodes;
-				GetAllNodesAtLevel(&head, height, nodes); 
-				DiscardFarNodes(nodes, 8);
-			}
-		}
+		// if appending, do not add the first node
+		if (clear || i > 0) {
+			CRoad srcRoad(GetCved(), cEdge.srcRoad);
+			// specified distance of 0.1 ft to add some padding
+			CRoadPos pos(srcRoad, cEdge.crdrId, 0.1, 0);
 
-		// if finding the shortest route and a route has been found, do not reset the route tree
-		if (done) {
-			break;
+			m_points.push_back(CPathPoint(pos));
 		}
 	}
 
+	totalDist += end.GetDistanceOnLane();
+	m_points.push_back(CPathPoint(end));
 
-	// if looking for shortest route, iterate through all routes and find the shortest one
-	if (shortest && routes.size() > 0) {
-		int shortestRoute = 0;
-		double min = routeDistances[0];
-		for(int i=1; i<routeDistances.size(); i++){
-			if (routeDistances[i] < min) {
-				shortestRoute = i;
-				min = routeDistances[i];
-			}
-		}
-
-		totalDist = min;
-		for(int i=0; i<routes[shortestRoute].size(); i++){
-			m_points.push_back(routes[shortestRoute][i]);
-		}
-		return true;
-	}
+	return true;
+}
 
-	// if the function reaches this point then no routes were found and the optimizations probably need some fine-tuning
-	return false;
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: CalculateShortestRoute
+//  Calculates the shortest route between two points, regardless of the
+//	number of corridors it contains.
+//
+// Remarks: This is the same as CalculateRoute with shortest set to true and
+//	no limit on the number of corridors.  The route hierarchy is used when
+//	the LRI file contains one.
+//
+// Arguments:
+//	start - initial point
+//	end	- destination point
+//	totalDist - total distance of the route in feet
+//	clear - (default = true) flag denoting whether or not to clear the current path
+//
+// Returns: true if route was found, otherwise false
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CPath::CalculateShortestRoute(CRoadPos& start, CRoadPos& end, double& totalDist, bool clear) {
+	return CalculateRoute(start, end, totalDist, clear, true, 0);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -5514,8 +5207,8 @@ CPath::CalculateRoute(CRoadPos& start, CRoadPos& end, double& totalDist, bool cl
 //	end	- destination point
 //	totalDist - total distance of the route in feet
 //	shortest - (default = false), flag to find the shortest route
-//		note: finding shortest route takes significantly longer for complex routes
-//	maxHeight - (default = 25), maximum height of the tree before giving up
+//	maxHeight - (default = 25), maximum number of corridors in the route, or
+//		0 for no limit
 //
 // Returns: true if route was found, otherwise false. Also eturns false if path 
 //	has no points.
@@ -5529,204 +5222,4 @@ bool CPath::AppendRoute(CRoadPos end, double& totalDist, bool shortest, int maxH
 	return CalculateRoute(m_points[m_points.size()-1].GetRoadPos(), end, totalDist, false, shortest, maxHeight);
 }
 
-//////////////////////////////////////////////////////////////////////////////
-//
-// Description: GetRouteChildren
-//  Searches the provided node and populates its children vector. If a child
-//	leads to the destination road, the function will return true.
-//
-// Arguments: 
-//	roadIdx - initial road index
-//	dir	- initial road direction
-//	end - destination position
-//	height - level of tree to search on
-//	parent - pointer to node to search
-//
-// Returns: true if valid route found, otherwise false
-//
-//////////////////////////////////////////////////////////////////////////////
-bool CPath::GetRouteChildren(int roadIdx, cvELnDir dir, CRoadPos& end, int height, TRouteNode* parent, int maxAway) {
-	// if the node has been searched, descend farther down the tree
-	if (parent->searched) {
-		for(int i=0; i<parent->children.size(); i++){
-			if (GetRouteChildren(parent->children[i].roadIdx, parent->children[i].roadDir, end, height-1, &parent->children[i], maxAway)) {
-				// found a valid route
-				return true;
-			}
-		}
-	} else if (height == 1){ // if the node is at the correct height and has not been searched
-		// prevents this node from being searched again
-		parent->searched = true;
-
-		TCrdrVec crdrVec;
-		CRoad road(GetCved(), roadIdx);
-		CIntrsctn intr;
-
-		// check which direction we are traveling and get the correct intersection
-		if (dir == eNEG) {
-			intr = road.GetSourceIntrsctn();
-		} else {
-			intr = road.GetDestIntrsctn();
-		}
-
-		// get all corridors
-		intr.GetCrdrsStartingFrom(road, crdrVec);
-
-		for(int i=0; i<crdrVec.size(); i++) {
-			if (!crdrVec[i].GetSrcLn().IsDrivingLane()) {
-				// cars cannot drive on this lane
-				continue;
-			}
-
-			// store route info
-			TRouteNode node;
-			node.head = false;
-			node.parent = parent;
-			node.found = false;
-			node.searched = false;
-			node.srcRoadIdx = road.GetId();
-			node.srcCrdrId = crdrVec[i].GetRelativeId();
-			node.srcLaneId = crdrVec[i].GetSrcLn().GetRelativeId();
-			node.roadIdx = crdrVec[i].GetDstntnRdIdx();
-			node.roadDir = crdrVec[i].GetDstntnLn().GetDirection();
-			node.length = crdrVec[i].GetSrcLn().GetRoad().GetLinearLength() + crdrVec[i].GetLength();
-
-			// calculate the linear distance from the current node to the destination point
-			TCntrlPnt* cntrlPnt;
-			if (maxAway != -1) {
-				// determine which side of the road to use (use either the beginning or the end)
-				if (dir == eNEG ) {
-					cntrlPnt = BindCntrlPnt(road.GetCntrlPntIdx());
-				} else {
-					cntrlPnt = BindCntrlPnt(road.GetCntrlPntIdx() + road.GetCntrlPntCount());
-				}
-
-				// since distance is used only for comparison, no need to square root
-				node.linearDistSquared = (cntrlPnt->location.x - end.GetVeryBestXYZ().m_x) * (cntrlPnt->location.x - end.GetVeryBestXYZ().m_x) +
-										 (cntrlPnt->location.y - end.GetVeryBestXYZ().m_y) * (cntrlPnt->location.y - end.GetVeryBestXYZ().m_y) +
-										 (cntrlPnt->location.z - end.GetVeryBestXYZ().m_z) * (cntrlPnt->location.z - end.GetVeryBestXYZ().m_z) ;
-
-				if (node.linearDistSquared > parent->linearDistSquared) { 
-					// increment awayNodes counter
-					node.awayNodes = parent->awayNodes + 1;
-
-					if (node.awayNodes > maxAway) {
-						node.searched = true; // prevent node from being searched again
-					}
-				} else {
-					node.awayNodes = 0; // reset awayNodes counter
-				}
-			} 
-			
-			// found a valid path
-			if (node.roadIdx == end.GetRoad().GetId() && node.roadDir == end.GetLane().GetDirection()) {
-				node.found = true;
-				node.searched = true;	// prevents this node from being searched again if searching for shortest route
-				parent->children.push_back(node);
-
-				// mark each parent node as part of the route
-				TRouteNode* ptr = parent;
-				while(!ptr->head) {
-					ptr->found = true;
-					ptr = ptr->parent;
-				}
-
-				return true;
-			}
-
-			// did not find valid path; add to parent's children
-			parent->children.push_back(node);
-		}
-	}
-
-	// unable to find a route from this node
-	return false;
-}
-
-//////////////////////////////////////////////////////////////////////////////
-//
-// Description: GetAllNodesAtLevel
-//  Recursively descends the route tree until it reaches the specified level.
-//	Once at the specified level the function populates the output vector
-//	with the route nodes.
-//
-// Arguments: 
-//	parent - current node
-//	level - level of the tree to search for
-//	out - (output) vector containing a pointer to all nodes at the specified
-//			level
-//
-//////////////////////////////////////////////////////////////////////////////
-void CPath::GetAllNodesAtLevel(TRouteNode* parent, int level, std::vector<TRouteNode*>& out) {
-	if (level > 0) {
-		// descend
-		for(int i=0; i<parent->children.size(); i++){ 
-			GetAllNodesAtLevel(&parent->children[i], level-1, out);
-		}
-	} else {
-		// at the correct level
-		out.push_back(parent);
-	}
-}
-
-//////////////////////////////////////////////////////////////////////////////
-//
-// Description: DiscardFarNodes
-//  Searches a vector of nodes and discards all but a user-specified number of
-//	nodes. Nodes are discarded based on their linear distance to the
-//	destination point.
-//
-// Arguments: 
-//	nodes - all nodes to search
-//	numToKeep - number of nodes to keep
-//
-//////////////////////////////////////////////////////////////////////////////
-void CPath::DiscardFarNodes(std::vector<TRouteNode*>& nodes, int numToKeep) {
-	// invalid inputs
-	if (numToKeep > nodes.size() || numToKeep < 1) {
-		return;
-	}
-
-	// indices of nodes to keep
-	std::vector<int> keep;
-	
-	// set default indices
-	for(int i=0; i<numToKeep; i++) {
-		keep.push_back(i) ;
-	}
-
-	// keep track of which index has the maximum distance
-	int max = 0;
-
-	// find the largest distance amongst the initial nodes
-	for(int i=1; i<keep.size()-1; i++) {
-		if (nodes[i]->linearDistSquared > nodes[max]->linearDistSquared) {
-			max = i;
-		}
-	}
-
-	// search all nodes for smaller distances
-	for(int i=numToKeep; i<nodes.size(); i++) {
-		if (nodes[i]->linearDistSquared < nodes[ keep[max] ]->linearDistSquared) {
-			//insert node index here
-			keep[max] = i;
-
-			// find new max
-			for(int j=0; j<keep.size(); j++) {
-				if ( nodes[ keep[j] ]->linearDistSquared > nodes[ keep[max] ]->linearDistSquared ) {
-					max = j;
-				}
-			}
-		}
-	}
-
-	// stop searching in nodes that are too far away
-	for(int i=0; i<nodes.size(); i++) {
-		nodes[i]->searched = true;
-	}
-	for(int i=0; i<numToKeep; i++) {
-		nodes[ keep[i] ]->searched = false;
-	}
-}
-
 } // namespace CVED
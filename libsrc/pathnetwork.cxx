@@ -493,45 +493,48 @@ CPathNetwork::GetPathsTowards(vector<CPath>& pathVec,
 	int srcIsec = -1;
 	int dstRoad = -1;
 	// If the roadPos lies on a road, 
-	//	search within the m_roadPnts map
+	//	look up its road in the m_roadPnts map
 	if (roadPos.IsRoad()) {
 		TRoadPointMap::const_iterator pRd;
-		for (pRd = m_roadPnts.begin(); pRd != m_roadPnts.end(); pRd++) {
+		pRd = m_roadPnts.find(roadPos.GetRoad().GetId());
+		if (pRd != m_roadPnts.end()) {
 
 			if ( (pRd->second.posPoint.pathPoint.IsValid()) &&
 				 (pRd->second.posPoint.pathPoint.Contains(roadPos)) ) {
 				path.Prepend(pRd->second.posPoint.pathPoint);
 				srcIsec = pRd->second.posPoint.srcIntrsctnId;
 				dstRoad = pRd->first;
-				break;
 			}
 			else if ( (pRd->second.negPoint.pathPoint.IsValid()) &&
 					  (pRd->second.negPoint.pathPoint.Contains(roadPos)) ) {
 				path.Prepend(pRd->second.negPoint.pathPoint);
 				srcIsec = pRd->second.negPoint.srcIntrsctnId;
 				dstRoad = pRd->first;
-				break;
 			} 
 		}
 	}
 
 	// Else, the roadPos lies on an intersection, 
-	// 	so search within m_intrsctnPnts map
+	// 	so look up its intersection in the m_intrsctnPnts map
 	else {
 
 		TIsecPointMap::const_iterator pIs;
-		for (pIs = m_intrsctnPnts.begin(); 
-			 pIs != m_intrsctnPnts.end(); pIs++) {
-			
-			if (pIs->second.Contains(roadPos)) {
-				srcIsec = pIs->first;
-				break;
-			}
+		pIs = m_intrsctnPnts.find(roadPos.GetIntrsctn().GetId());
+		if ( (pIs != m_intrsctnPnts.end()) && 
+			 (pIs->second.Contains(roadPos)) ) {
+			srcIsec = pIs->first;
 		}
 	}
 	
+	// Mark the roads and intersections already on the path
+	cvTHeader* pH = static_cast<cvTHeader*>(GetInst());
+	TOnPath onPath;
+	onPath.numRoads = pH->roadCount;
+	onPath.isOnPath.assign(pH->roadCount + pH->intrsctnCount, false);
+	AddToOnPath(path, path.Size(), onPath);
+
 	// Call recursive function to get all paths headed towards roadPos
-	if ( (!RecursiveTowards(srcIsec, dstRoad, path, pathVec)) &&
+	if ( (!RecursiveTowards(srcIsec, dstRoad, path, pathVec, onPath)) &&
 		 (path.Size() > 0) )
 		 pathVec.push_back(path);
 
@@ -583,6 +586,7 @@ CPathNetwork::GetPathsTowards(vector<CPath>& pathVec,
 // 		only the ones terminating at dstRoad.
 //	curPath - current CPath to prepend successive CPathPoints to.
 //	pathVec - cumulative vector of CPaths radiating from the original curPath
+//	onPath - the roads and intersections on curPath, updated along with it
 //
 // Returns: True if the curPath parameter was modified (i.e. found to connect
 // 	to something), false otherwise.
@@ -591,7 +595,8 @@ CPathNetwork::GetPathsTowards(vector<CPath>& pathVec,
 bool 
 CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 							   CPath& curPath,
-							   vector<CPath>& pathVec) const
+							   vector<CPath>& pathVec,
+							   TOnPath& onPath) const
 {
 	// BASE: unknown srcIsec
 	TIsecPointMap::const_iterator pIsMap;
@@ -606,12 +611,14 @@ CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 
 		// If the current path already contains the
 		//	given intersection, return.
-		if (AlreadyContains(curPath, pIsMap->second.m_intrsctn))
+		if (AlreadyContains(onPath, pIsMap->second.m_intrsctn))
 			return true;
 
 		// Prepend the srcIsec
+		int size = curPath.Size();
 		if (!curPath.Prepend(pIsMap->second))
 			return false;
+		AddToOnPath(curPath, curPath.Size() - size, onPath);
 
 #if PATH_NETWORK_DEBUG
 		gout << curPath.Size() 
@@ -624,6 +631,7 @@ CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 		// 	intersection, so that each possible 
 		// 	route may be found
 		CPath origPath = curPath;
+		int origOnPath = (int) onPath.onPath.size();
 		
 		// Get all connecting roads in srcIsec
 		vector<CRoad> roads;
@@ -646,7 +654,7 @@ CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 			
 			// If the path already contains the given road, 
 			//	then continue onto the next road
-			if (AlreadyContains(curPath, *pRd))
+			if (AlreadyContains(onPath, *pRd))
 				continue;
 
 			// If the road exists in the map
@@ -673,9 +681,11 @@ CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 						
 						pos = true;
 						
+						size = curPath.Size();
 						if (!curPath.Prepend(
 								pRdMap->second.posPoint.pathPoint))
 							return false;
+						AddToOnPath(curPath, curPath.Size() - size, onPath);
 						
 #if PATH_NETWORK_DEBUG
 						gout << curPath.Size() 
@@ -689,7 +699,8 @@ CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 								pRdMap->second.posPoint.srcIntrsctnId,
 								pRdMap->first,
 								curPath, 
-								pathVec)) ||
+								pathVec,
+								onPath)) ||
 								(first) ) {
 							first = false;
 							pathVec.push_back(curPath);
@@ -703,9 +714,11 @@ CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 						
 						neg = true;
 
+						size = curPath.Size();
 						if (!curPath.Prepend(
 								pRdMap->second.negPoint.pathPoint))
 							return false;
+						AddToOnPath(curPath, curPath.Size() - size, onPath);
 						
 						// If recuring with the current path is successful, 
 						// 	push it back onto the pathVec
@@ -713,7 +726,8 @@ CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 								pRdMap->second.negPoint.srcIntrsctnId,
 								pRdMap->first,
 								curPath, 
-								pathVec)) ||
+								pathVec,
+								onPath)) ||
 								(first) ) {
 							first = false;
 							pathVec.push_back(curPath);
@@ -730,6 +744,7 @@ CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 
 			// For the next iteration, reset curPath back to the original
 			curPath = origPath;
+			RevertOnPath(origOnPath, onPath);
 			
 		} // For each connecting road from srcIsec
 
@@ -740,31 +755,84 @@ CPathNetwork::RecursiveTowards(int srcIsec, int dstRoad,
 
 //////////////////////////////////////////////////////////////////////////////
 //
-// Description: AlreadyContains (private)
+// Description: AddToOnPath (private)
 // 	This is a static helper function for RecursiveTowards.  
 //
-// Remarks: This function returns true if the given path already contains a 
-//	node on the given intersection.
+// Remarks: This function marks the roads and intersections of the points
+//	that were just prepended to the given path.  Prepending a single
+//	CPathPoint may add more than one point when the path has to be
+//	connected to it.
 //
 // Arguments:
-//	path - a const CPath instance to check for isec
-//	isec - a const CIntrsctn instance to search for in path
+//	path - the path that points were prepended to
+//	numPrepended - the number of points at the front of the path to mark
+//	onPath - the roads and intersections on the path
 //
-// Returns: True if the given path already contains a node on the given 
-//	intersection, false otherwise.
+// Returns: void
 // 	
 //////////////////////////////////////////////////////////////////////////////
-bool
-CPathNetwork::AlreadyContains(const CPath& path, const CIntrsctn& isec) 
+void
+CPathNetwork::AddToOnPath(const CPath& path, int numPrepended, 
+						  TOnPath& onPath)
 {
 	CPath::cTPathIterator itr;
 
-	for (itr = path.Begin(); itr != path.End(); itr++) {
-		if ( (!path.m_points[itr].m_isRoad) &&
-			 (path.m_points[itr].m_intrsctn.GetId() == isec.GetId()) )
-			return true;
+	for (itr = path.Begin(); itr != path.Begin() + numPrepended; itr++) {
+		const CPathPoint& point = path.m_points[itr];
+		int idx = point.m_isRoad ? point.m_road.GetId() :
+					onPath.numRoads + point.m_intrsctn.GetId();
+		if (!onPath.isOnPath[idx]) {
+			onPath.isOnPath[idx] = true;
+			onPath.onPath.push_back(idx);
+		}
+	}
+} // end of AddToOnPath
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: RevertOnPath (private)
+// 	This is a static helper function for RecursiveTowards.  
+//
+// Remarks: This function clears the marks set since onPath held the
+//	given number of entries, to match a path that was reset to an earlier
+//	copy of itself.
+//
+// Arguments:
+//	size - the number of entries to keep
+//	onPath - the roads and intersections on the path
+//
+// Returns: void
+// 	
+//////////////////////////////////////////////////////////////////////////////
+void
+CPathNetwork::RevertOnPath(int size, TOnPath& onPath)
+{
+	while ((int) onPath.onPath.size() > size) {
+		onPath.isOnPath[onPath.onPath.back()] = false;
+		onPath.onPath.pop_back();
 	}
-	return false;
+} // end of RevertOnPath
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: AlreadyContains (private)
+// 	This is a static helper function for RecursiveTowards.  
+//
+// Remarks: This function returns true if the path described by onPath 
+//	already contains a node on the given intersection.
+//
+// Arguments:
+//	onPath - the roads and intersections on the path
+//	isec - a const CIntrsctn instance to search for in the path
+//
+// Returns: True if the path already contains a node on the given 
+//	intersection, false otherwise.
+// 	
+//////////////////////////////////////////////////////////////////////////////
+bool
+CPathNetwork::AlreadyContains(const TOnPath& onPath, const CIntrsctn& isec) 
+{
+	return onPath.isOnPath[onPath.numRoads + isec.GetId()];
 } // end of AlreadyContains
 
 //////////////////////////////////////////////////////////////////////////////
@@ -772,28 +840,21 @@ CPathNetwork::AlreadyContains(const CPath& path, const CIntrsctn& isec)
 // Description: AlreadyContains (private)
 // 	This is a static helper function for RecursiveTowards.  
 //
-// Remarks: This function returns true if the given path already contains a 
-//	node on the given road.
+// Remarks: This function returns true if the path described by onPath 
+//	already contains a node on the given road.
 //
 // Arguments:
-//	path - a const CPath instance to check for road
-//	road - a const CRoad instance to search for in path
+//	onPath - the roads and intersections on the path
+//	road - a const CRoad instance to search for in the path
 //
-// Returns: True if the given path already contains a node on the given 
+// Returns: True if the path already contains a node on the given 
 //	road, false otherwise.
 // 	
 //////////////////////////////////////////////////////////////////////////////
 bool
-CPathNetwork::AlreadyContains(const CPath& path, const CRoad& road) 
+CPathNetwork::AlreadyContains(const TOnPath& onPath, const CRoad& road) 
 {
-	CPath::cTPathIterator itr;
-
-	for (itr = path.Begin(); itr != path.End(); itr++) {
-		if ( (path.m_points[itr].m_isRoad) &&
-			 (path.m_points[itr].m_road.GetId() == road.GetId()) )
-			return true;
-	}
-	return false;
+	return onPath.isOnPath[road.GetId()];
 } // end of AlreadyContains
 
 } // namespace CVED
@@ -227,9 +227,13 @@ CPathPoint::~CPathPoint()
 
 //////////////////////////////////////////////////////////////////////////////
 //
-// Description: The copy destructor calls the assignment operator.
+// Description: The copy constructor copies the parameter to the current 
+//   instance.
 //
-// Remarks:
+// Remarks: The members are initialized directly rather than default 
+//   constructed and then assigned, since paths copy their points often.
+//   All the data of a CPathPoint is stored inline, so copying it never 
+//   allocates memory.
 //
 // Arguments:
 //	 cCopy - CPathPoint instance to copy to the current instance.
@@ -238,8 +242,18 @@ CPathPoint::~CPathPoint()
 //
 //////////////////////////////////////////////////////////////////////////////
 CPathPoint::CPathPoint( const CPathPoint& cCopy )
+	:
+	CCvedItem( cCopy ),
+	m_isRoad( cCopy.m_isRoad ),
+	m_road( cCopy.m_road ),
+	m_intrsctn( cCopy.m_intrsctn ),
+	m_laneCrdrMask( cCopy.m_laneCrdrMask )
 {
-	*this = cCopy;
+	for( int i = 0; i < cCV_MAX_CRDRS; i++ )
+	{
+		m_startDist[i] = cCopy.m_startDist[i];
+		m_endDist[i] = cCopy.m_endDist[i];
+	}
 }  // end of CPathPoint
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2718,8 +2732,9 @@ CPathPoint::Contains( const CRoadPos& cRoadPos ) const
 		bool sameIntrsctn = m_intrsctn.GetId() == cRoadPos.GetIntrsctn().GetId();
 		if( sameIntrsctn)
 		{
-			// If cRoadPos is on a lane in the mask
-			vector<int> crds;
+			// If cRoadPos is on a lane in the mask; the corridor
+			// list is reused, since the path is searched every frame
+			static thread_local vector<int> crds;
 			cRoadPos.GetCorridors(crds);
 			vector<int>::const_iterator itr;
 			int intrCrdrIdx = m_intrsctn.GetCrdrIdx() ;
@@ -0,0 +1,216 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version:     $Id: qrymemo.cxx,v 1.1 $
+//
+// Author(s):
+// Date:
+//
+// Description: The implementation of the memoization of CCved queries
+//  within a frame.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include "cvedpub.h"
+#include "cvedstrc.h"
+
+namespace CVED{
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SetQryMemo
+//  Enables or disables the reuse of query results within a frame.
+//
+// Remarks: While enabled, GetAllDynObjsOnRoad, GetObjsNear and
+//  GetTrafLightsNear remember the results of the queries made during the
+//  current frame, and a query with the same arguments returns the
+//  remembered result instead of searching again.  The results are
+//  discarded by the Maintainer, when the frame changes, and when a static
+//  object is created, so callers see the same results as without
+//  memoization.
+//
+//  The remembered results are shared by all callers, so memoization
+//  should only be enabled when these queries are made from one thread.
+//  Disabling it discards the remembered results but keeps the counters.
+//
+// Arguments:
+//  enable - true to enable memoization, false to disable it
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::SetQryMemo( bool enable )
+{
+	m_qryMemoEnabled = enable;
+	ClearQryMemo();
+} // end of SetQryMemo
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetQryMemo
+//  Indicates whether query results are reused within a frame.
+//
+// Returns: true if memoization is enabled, false otherwise
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CCved::GetQryMemo( void ) const
+{
+	return m_qryMemoEnabled;
+} // end of GetQryMemo
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetQryMemoStats
+//  Returns the number of memoized queries answered from a remembered
+//  result and the number that had to search.
+//
+// Remarks: Queries made while memoization is disabled are not counted.
+//
+// Arguments:
+//  hits - (output) queries answered from a remembered result
+//  misses - (output) queries that had to search
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::GetQryMemoStats( int& hits, int& misses ) const
+{
+	hits   = m_qryMemoHits;
+	misses = m_qryMemoMisses;
+} // end of GetQryMemoStats
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: ResetQryMemoStats
+//  Sets the counters returned by GetQryMemoStats to 0.
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::ResetQryMemoStats( void )
+{
+	m_qryMemoHits   = 0;
+	m_qryMemoMisses = 0;
+} // end of ResetQryMemoStats
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: TQryMemoKey
+//  Builds the key of a memoized query from its arguments.
+//
+// Remarks: Arguments that a query does not have should be passed as 0 or
+//  as a default constructed value, so that they compare equal.
+//
+//////////////////////////////////////////////////////////////////////////////
+CCved::TQryMemoKey::TQryMemoKey(
+			EQryMemoKind kind,
+			int id,
+			TU32b lanes,
+			const CObjTypeMask& cMask,
+			const CPoint3D& cLoc,
+			double radius
+			)
+	: kind( kind ),
+	  id( id ),
+	  lanes( lanes ),
+	  mask( 0 ),
+	  x( cLoc.m_x ),
+	  y( cLoc.m_y ),
+	  z( cLoc.m_z ),
+	  radius( radius )
+{
+	int type;
+	for( type = 0; type < cNUM_OBJECT_TYPES; type++ )
+	{
+		if( cMask.Has( (cvEObjType) type ) )  mask |= 1u << type;
+	}
+} // end of TQryMemoKey
+
+bool
+CCved::TQryMemoKey::operator<( const TQryMemoKey& cRhs ) const
+{
+	return (
+		tie( kind, id, lanes, mask, x, y, z, radius ) <
+		tie( cRhs.kind, cRhs.id, cRhs.lanes, cRhs.mask,
+				cRhs.x, cRhs.y, cRhs.z, cRhs.radius )
+		);
+} // end of operator<
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: FindQryMemo (protected)
+//  Looks for the remembered result of a query made during the current
+//  frame.
+//
+// Remarks: Results from an earlier frame are discarded first.  Updates
+//  the hit and miss counters.
+//
+// Arguments:
+//  cKey - the arguments of the query
+//
+// Returns: A pointer to the remembered result, or 0 if there is none.
+//
+//////////////////////////////////////////////////////////////////////////////
+const CCved::TIntVec*
+CCved::FindQryMemo( const TQryMemoKey& cKey ) const
+{
+	if( m_qryMemoFrame != m_pHdr->frame )
+	{
+		m_qryMemo.clear();
+		m_qryMemoFrame = m_pHdr->frame;
+	}
+
+	TQryMemo::const_iterator itr = m_qryMemo.find( cKey );
+	if( itr == m_qryMemo.end() )
+	{
+		m_qryMemoMisses++;
+		return 0;
+	}
+
+	m_qryMemoHits++;
+	return &itr->second;
+} // end of FindQryMemo
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: AddQryMemo (protected)
+//  Remembers the result of a query made during the current frame.
+//
+// Arguments:
+//  cKey - the arguments of the query
+//  first, last - the object identifiers the query returned
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::AddQryMemo(
+			const TQryMemoKey& cKey,
+			TIntVec::const_iterator first,
+			TIntVec::const_iterator last
+			) const
+{
+	m_qryMemo[cKey].assign( first, last );
+	m_qryMemoFrame = m_pHdr->frame;
+} // end of AddQryMemo
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: ClearQryMemo (protected)
+//  Discards all remembered query results.
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CCved::ClearQryMemo( void )
+{
+	m_qryMemo.clear();
+} // end of ClearQryMemo
+
+} // namespace CVED
@@ -832,6 +832,10 @@ CRoad::End(const CLane* cLane) {
 /// 	This function determines if the attribute with identifier id applies on 
 /// 	the current road at the point of the road located dist units from its 
 /// 	start.
+///\par
+/// 	The attributes read from the LRI file are found through the index 
+/// 	built by CCved::BuildAttrIdx, so the cost grows with the log of the 
+/// 	number of attributes on the road.
 ///
 ///\param 	id   - The attribute identifier.
 ///\param 	dist - The distance along the road to check for the attribute.
@@ -846,11 +850,13 @@ CRoad::ActiveAttr( int id, double dist ) const
 
 	cvTHeader* pH    = static_cast<cvTHeader*>  ( GetInst() );
 	char*      pOfs  = static_cast<char*>       ( GetInst() ) + pH->attrOfs;
-	cvTAttr*   pAttr = (reinterpret_cast<cvTAttr*>(pOfs)) +	m_pRoad->attrIdx;
+	cvTAttr*   pPool = reinterpret_cast<cvTAttr*>(pOfs);
+	cvTAttr*   pAttr = pPool + m_pRoad->attrIdx;
 
-	// For each attribute on the road
+	// For each attribute set on the road at runtime
+	int numExtra = min( m_pRoad->numAttr, cCV_LRI_ROAD_ATTR_EXTRA );
 	int i;
-	for( i = 0; i < m_pRoad->numAttr; i++, pAttr++ )
+	for( i = 0; i < numExtra; i++, pAttr++ )
 	{
 		// If the attr ids match ...
 		bool match = pAttr->myId == id;
@@ -865,7 +871,24 @@ CRoad::ActiveAttr( int id, double dist ) const
 			if( distInRangeOfAttr )  return true;
 		}
 
-	} // For each attribute on the road
+	} // For each attribute set at runtime
+
+	// The attributes from the LRI file with the given id, in order of
+	// starting distance
+	int num;
+	const int* pIdx = GetRoadAttrs( GetId(), num );
+	const int* pLast = pIdx + num;
+	pIdx = lower_bound( pIdx, pLast, id,
+				[pPool]( int attrIdx, int attrId ) {
+					return pPool[attrIdx].myId < attrId;
+				} );
+
+	for( ; pIdx != pLast && pPool[*pIdx].myId == id; pIdx++ )
+	{
+		pAttr = pPool + *pIdx;
+		if( dist >= 0 && pAttr->from >= dist )  break;
+		if( dist < 0 || pAttr->to < 0 || dist < pAttr->to )  return true;
+	}
 
 	// No matching attribute found
 	return false;
@@ -881,7 +904,10 @@ CRoad::ActiveAttr( int id, double dist ) const
 ///\remark 
 ///		This function will cause a failed assertion if it is called 
 ///		on an invalid CRoad instance.
-/// 
+///\par
+///		The attributes read from the LRI file are found through the index 
+///		built by CCved::BuildAttrIdx.  If several attributes match, the one 
+///		stored first on the road is returned.
 /// 
 ///\param	id    - Identifier of an attribute type.
 ///\param	attr  - Output parameter that contains the desired attribute, if the 
@@ -899,18 +925,19 @@ CRoad::QryAttr( int id, CAttr& attr, int laneMask, double dist) const
 {
 	AssertValid();
 
+	// slots without an attribute have an id of 0
+	if( id == 0 )  return false;
+
 	cvTHeader* pH    = static_cast<cvTHeader*>  ( GetInst() );
 	char*      pOfs  = static_cast<char*>       ( GetInst() ) + pH->attrOfs;
-	cvTAttr*   pAttr = (reinterpret_cast<cvTAttr*>(pOfs)) +	m_pRoad->attrIdx;
+	cvTAttr*   pPool = reinterpret_cast<cvTAttr*>(pOfs);
+	cvTAttr*   pAttr = pPool + m_pRoad->attrIdx;
 
-
-	// For each attribute on the road
+	// For each attribute set on the road at runtime; these come first
+	int numExtra = min( m_pRoad->numAttr, cCV_LRI_ROAD_ATTR_EXTRA );
 	int i;
-	for( i = 0; i < m_pRoad->numAttr; i++, pAttr++ )
+	for( i = 0; i < numExtra; i++, pAttr++ )
 	{
-		// take out those reserved for attributes created at runtime.
-		if( pAttr->myId == 0 )  continue;
-
 		// If the attr ids match ...
 		if( pAttr->myId == id )
 		{
@@ -932,10 +959,44 @@ CRoad::QryAttr( int id, CAttr& attr, int laneMask, double dist) const
 				}
 			}
 		}
-	} // For each attribute on the road
+	} // For each attribute set at runtime
 
-	// No matching attribute found
-	return false;
+	//
+	// Look up the attributes from the LRI file in the index.  Those with
+	// the given id are sorted by starting distance, so the search stops
+	// at the first one that starts at or after dist.  If several match,
+	// the one stored first on the road is returned.
+	//
+	int num;
+	const int* pIdx = GetRoadAttrs( GetId(), num );
+	const int* pLast = pIdx + num;
+	pIdx = lower_bound( pIdx, pLast, id,
+				[pPool]( int attrIdx, int attrId ) {
+					return pPool[attrIdx].myId < attrId;
+				} );
+
+	int found = -1;
+	for( ; pIdx != pLast && pPool[*pIdx].myId == id; pIdx++ )
+	{
+		pAttr = pPool + *pIdx;
+		if( dist >= 0 && pAttr->from >= dist )  break;
+
+		bool match = (
+			( found < 0 || *pIdx < found ) &&
+			( pAttr->laneMask & laneMask ) &&
+			( dist < 0 || pAttr->to < 0 || dist < pAttr->to )
+			);
+		if( match )  found = *pIdx;
+	}
+
+	if( found < 0 )
+	{
+		// No matching attribute found
+		return false;
+	}
+
+	attr = CAttr( GetCved(), pPool + found );
+	return true;
 } // end of QryAttr
 
 //////////////////////////////////////////////////////////////////////////////
@@ -148,7 +148,6 @@ CRoadPos::operator=( const CRoadPos& cRhs )
 
 		m_pIntrsctn		= cRhs.m_pIntrsctn;
 
-		m_cdo.clear();
 		m_cdo			= cRhs.m_cdo;
 
 		m_pRng          = cRhs.m_pRng;
@@ -157,6 +156,47 @@ CRoadPos::operator=( const CRoadPos& cRhs )
 	return *this;
 } // end of operator=
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: operator=
+// 	Moves the contents of the CRoadPos parameter to the current object.
+//
+// Remarks: The same members as the copy assignment are transferred.  The
+// 	corridor list is taken over from the parameter when it is stored on
+// 	the heap, and the parameter is left without corridors.
+//
+// Arguments:
+//  rhs - a reference to an object intended to be to the right of the =
+//
+// Returns: a reference to the current object
+//
+//////////////////////////////////////////////////////////////////////////////
+CRoadPos&
+CRoadPos::operator=( CRoadPos&& rhs ) noexcept
+{
+	if (&rhs != this) 
+	{
+		// Assign superclass members
+		this->CCvedItem::operator=( rhs );
+
+		m_isRoad		= rhs.m_isRoad;
+		
+		m_pRoad			= rhs.m_pRoad;
+		m_pLane			= rhs.m_pLane;
+		m_dist			= rhs.m_dist;
+		m_ofs			= rhs.m_ofs;
+		m_cntrlPntIdx 	= rhs.m_cntrlPntIdx;
+
+		m_pIntrsctn		= rhs.m_pIntrsctn;
+
+		m_cdo			= static_cast<TCdoVec&&>( rhs.m_cdo );
+
+		m_pRng          = rhs.m_pRng;
+		m_rngStreamId   = rhs.m_rngStreamId;
+	}
+	return *this;
+} // end of operator=
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description: ~CRoadPos
@@ -656,7 +696,7 @@ CRoadPos::GetCorridor(int id) const
 	
 	if (!m_isRoad) {
 		
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
 
 			if ( (id < 0) || 
@@ -792,7 +832,7 @@ CRoadPos::GetNextCrdr(int& crdrId, ETravelTurnDir& dirOut, ETravelTurnDir eTurnD
 			curCPRVec.m_j = pCurCP->rightVecLinear.j;
 			curCPRVec.m_k = 0.0;
 		} else {
-			vector<TCdo>::const_iterator cdo = m_cdo.begin();
+			TCdoVec::const_iterator cdo = m_cdo.begin();
 			TCrdrPnt* pCurCP = BindCrdrPnt(cdo->cntrlPntIdx);
 
 			curCPRVec.m_i = pCurCP->rightVecLinear.i;
@@ -1038,7 +1078,7 @@ CRoadPos::GetPrevCrdr(int& crdrId, ETravelTurnDir& dirOut, ETravelTurnDir eTurnD
 			curCPRVec.m_j = pCurCP->rightVecLinear.j;
 			curCPRVec.m_k = 0.0;
 		} else {
-			vector<TCdo>::const_iterator cdo = m_cdo.begin();
+			TCdoVec::const_iterator cdo = m_cdo.begin();
 			TCrdrPnt* pCurCP = BindCrdrPnt(cdo->cntrlPntIdx);
 
 			curCPRVec.m_i = pCurCP->rightVecLinear.i;
@@ -1186,7 +1226,7 @@ CRoadPos::GetCorridorWithAbsoluteId(int id) const
 	
 	if (!m_isRoad) {
 		
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
 
 			if ( (id < 0) || 
@@ -1214,7 +1254,7 @@ bool CRoadPos::GetCorridors(vector<int> &crds) const{
 	AssertValid();
 	crds.clear();
 	if (!m_isRoad) {
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
 			crds.push_back(itr->pCrdr->myId);
 		}
@@ -1237,7 +1277,7 @@ bool CRoadPos::GetCorridors(vector< pair<int,double> > &crds) const{
 	AssertValid();
 	crds.clear();
 	if (!m_isRoad) {
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
             crds.push_back(make_pair(itr->pCrdr->myId,itr->dist));
 		}
@@ -1268,7 +1308,7 @@ CRoadPos::HasCorridor(int crdrId) const
 	AssertValid();
 	
 	if (!m_isRoad) {
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
 
 			if ( (itr->pCrdr->myId - m_pIntrsctn->crdrIdx) == crdrId )
@@ -1300,7 +1340,7 @@ CRoadPos::HasCorridorWithAbsoluteId(int crdrId) const{
 	AssertValid();
 	
 	if (!m_isRoad) {
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
 
 			if ( itr->pCrdr->myId == crdrId )
@@ -1454,133 +1494,14 @@ CRoadPos::GetDistanceToNextIntrsctn(void) const
 //////////////////////////////////////////////////////////////////////////////
 double
 CRoadPos::GetDistToNextHldOfs( int lookahead ) const{
-	CIntrsctn intr;
-	vector<CHldOfs> hldOfsList;
-	TCrdrVec crdrVec;
-
-	// get the next or current intersection
-	intr = GetNextIntrsctn();
-	if (!intr.IsValid()){
-		return -1;
-	}
-
-	CLane lane = GetLane();
-	if (IsRoad() && !lane.IsValid()){
+	double dist;
+	int crdrId = FindNextHldOfsCrdr( lookahead, dist );
+	if (crdrId == 0){
 		return -1;
 	}
 
-	int n = 0;
-	if (lookahead < 1){
-		lookahead = 1;
-	}
-
-	double dist = 0;
-	
-	// check if point is on a road or intersection
-	// may return the wrong haltline if a point lies on two different corridors
-	if (!IsRoad()){
-		// query the next few intersections for haltlines
-		while( n < lookahead ){
-			// check if any corridors contain the point and if so, return the haltline
-			intr.GetAllCrdrs(crdrVec);
-
-			if (crdrVec.size() == 0){
-				return -1;
-			}
-
-			for(size_t i=0; i<crdrVec.size(); i++){
-				if (HasCorridor(crdrVec[i].GetRelativeId())){
-					crdrVec[i].GetAllHldOfs(hldOfsList);
-					if (hldOfsList.size() > 0){
-						if (n == 0){
-							return hldOfsList.begin()->GetDistance() - GetDistanceOnLane(crdrVec[i].GetRelativeId());
-						} else {
-							return hldOfsList.begin()->GetDistance() + dist;
-						}
-					}
-				}
-			}
-
-			// no haltlines found
-			int crdr = -1;
-			for(size_t i=0; i<crdrVec.size(); i++){
-				if (HasCorridor(crdrVec[i].GetRelativeId())){
-					if (crdr == -1){
-						crdr = (int)i;
-					}
-					if (crdrVec[i].GetCrdrDirection() == CCrdr::eSTRAIGHT){
-						crdr = (int)i;
-						break;
-					}
-				}
-			}
-
-			// no corridors found
-			if (crdr == -1){
-				return -1;
-			}
-
-			// find the next lane & intersection
-			lane = crdrVec[crdr].GetDstntnLn();
-			if (!lane.IsValid()){
-				return -1;
-			}
-			intr = lane.GetNextIntrsctn();
-			if (!intr.IsValid()){
-				return -1;
-			}
-
-			if (n == 0){
-				dist += lane.GetRoad().GetLinearLength() + crdrVec[crdr].GetLength() - GetDistanceOnLane(crdrVec[crdr].GetRelativeId());
-			} else {
-				dist += lane.GetRoad().GetLinearLength() + crdrVec[crdr].GetLength();
-			}
-			n++;
-		}
-	} else {
-		// query the next few intersections for haltlines
-		dist += GetRoad().GetLinearLength() - GetDistanceOnLane();
-		while(n < lookahead){
-			// get all corridors connected to the lane given by the position
-			intr.GetCrdrsStartingFrom(lane, crdrVec);
-
-			// no corridors in intersection
-			if (crdrVec.size() == 0){
-				return -1;
-			}
-
-			for(size_t i=0; i<crdrVec.size(); i++){
-				crdrVec[i].GetAllHldOfs(hldOfsList);
-				if (hldOfsList.size() > 0){
-					return hldOfsList.begin()->GetDistance() + dist;
-				}
-			}
-
-			// no haltlines found, look for straight corridor so we can find the next intersection
-			int crdr = 0;
-			for(size_t i=0; i<crdrVec.size(); i++){
-				if (crdrVec[i].GetCrdrDirection() == CCrdr::eSTRAIGHT){
-					crdr = (int)i;
-					break;
-				}
-			}
-			// find the next lane & intersection
-			lane = crdrVec[crdr].GetDstntnLn();
-			if (!lane.IsValid()){
-				return -1;
-			}
-			intr = lane.GetNextIntrsctn();
-			if (!intr.IsValid()){
-				return -1;
-			}
-
-			dist += lane.GetRoad().GetLinearLength() + crdrVec[crdr].GetLength();
-			n++;
-		}
-	}
-
-	// failed to find a suitable corridor with a haltline
-	return -1;
+	CHldOfs hldOfs( GetCved(), BindCrdr( crdrId )->hldOfsIdx );
+	return hldOfs.GetDistance() + dist;
 }
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -1604,127 +1525,116 @@ CRoadPos::GetDistToNextHldOfs( int lookahead ) const{
 //////////////////////////////////////////////////////////////////////////////
 CHldOfs			
 CRoadPos::GetNextHldOfs( int* crdrIdOut , int lookahead ) const{
-	CIntrsctn intr;
-	vector<CHldOfs> hldOfsList;
-	TCrdrVec crdrVec;
-
-	// get the next or current intersection
-	intr = GetNextIntrsctn();
-	if (!intr.IsValid()){
+	double dist;
+	int crdrId = FindNextHldOfsCrdr( lookahead, dist );
+	if (crdrId == 0){
 		return CHldOfs();
 	}
 
-	CLane lane = GetLane();
-	if (IsRoad() && !lane.IsValid()){
-		return CHldOfs();
+	if (crdrIdOut){
+		*crdrIdOut = crdrId;
+	}
+	return CHldOfs( GetCved(), BindCrdr( crdrId )->hldOfsIdx );
+}
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Finds the corridor holding the next halt line ahead of the
+//	current position, for GetNextHldOfs and GetDistToNextHldOfs.
+//
+// Remarks: On an intersection, the corridors of the position are checked
+//	first, in the order of the intersection, and the lookahead continues
+//	along the first straight one, or the first one if none is straight.
+//	From the end of a lane, the corridors leaving the lane are handled the
+//	same way, using the table built by CCved when the LRI file is loaded.
+//
+// Arguments:
+// 	lookahead - the number of intersections to check
+//	dist - (output) the distance from the current position to the start 
+//		of the corridor holding the halt line; negative if the position
+//		is on that corridor.
+//
+// Returns: the identifier of the corridor, or 0 if no halt line was found
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CRoadPos::FindNextHldOfsCrdr( int lookahead, double& dist ) const{
+	if (!IsValid()){
+		return 0;
 	}
 
 	int n = 0;
 	if (lookahead < 1){
 		lookahead = 1;
 	}
+
+	int laneIdx;
 	
-	// check if point is on a road or intersection
 	// may return the wrong haltline if a point lies on two different corridors
 	if (!IsRoad()){
-		while( n < lookahead ){
-			// check if any corridors contain the point and if so, return the haltline
-			intr.GetAllCrdrs(crdrVec);
-
-			// no corridors in intersection
-			if (crdrVec.size() == 0){
-				return CHldOfs();
+		// check if any corridors contain the point and if so, return the 
+		// one that comes first in the intersection
+		const TCdo* pHldOfs = 0;
+		const TCdo* pFollow = 0;
+		TCdoVec::const_iterator itr;
+		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++){
+			TCrdr* pCrdr = itr->pCrdr;
+			if (pCrdr->numHldOfs > 0 && 
+				(pHldOfs == 0 || pCrdr->myId < pHldOfs->pCrdr->myId)){
+				pHldOfs = &*itr;
 			}
 
-			for(size_t i=0; i<crdrVec.size(); i++){
-				if (HasCorridor(crdrVec[i].GetRelativeId())){
-					crdrVec[i].GetAllHldOfs(hldOfsList);
-					if (hldOfsList.size() > 0){
-						if (crdrIdOut){
-							*crdrIdOut = crdrVec[i].GetId();
-						}
-						return *hldOfsList.begin();
-					}
-				}
+			bool straight = pCrdr->direction == cCV_CRDR_STRAIGHT_DIR;
+			if (pFollow == 0){
+				pFollow = &*itr;
 			}
-
-			// no haltlines found
-			int crdr = -1;
-			for(size_t i=0; i<crdrVec.size(); i++){
-				if (HasCorridor(crdrVec[i].GetRelativeId())){
-					if (crdr == -1){
-						crdr = (int)i;
-					}
-					if (crdrVec[i].GetCrdrDirection() == CCrdr::eSTRAIGHT){
-						crdr = (int)i;
-						break;
-					}
+			else {
+				bool followStraight = 
+					pFollow->pCrdr->direction == cCV_CRDR_STRAIGHT_DIR;
+				if ((straight && !followStraight) ||
+					(straight == followStraight &&
+					 pCrdr->myId < pFollow->pCrdr->myId)){
+					pFollow = &*itr;
 				}
 			}
-
-			// no corridors found
-			if (crdr == -1){
-				return CHldOfs();
-			}
-
-			// find the next lane & intersection
-			lane = crdrVec[crdr].GetDstntnLn();
-			if (!lane.IsValid()){
-				return CHldOfs();
-			}
-			intr = lane.GetNextIntrsctn();
-			if (!intr.IsValid()){
-				return CHldOfs();
-			}
-
-			n++;
 		}
-	} else {
-		// query the next few intersections for haltlines
-		while(n < lookahead ){
-			// get all corridors connected to the lane given by the position
-			intr.GetCrdrsStartingFrom(lane, crdrVec);
-
-			//no corridors in intersection
-			if (crdrVec.size() == 0){
-				return CHldOfs();
-			}
 
-			for(size_t i=0; i<crdrVec.size(); i++){
-				crdrVec[i].GetAllHldOfs(hldOfsList);
-				if (hldOfsList.size() > 0){
-					if (crdrIdOut){
-						*crdrIdOut = crdrVec[i].GetId();
-					}
-					return *hldOfsList.begin();
-				}
-			}
+		if (pHldOfs){
+			dist = -pHldOfs->dist;
+			return pHldOfs->pCrdr->myId;
+		}
 
-			// no haltlines found, look for straight corridor so we can find the next intersection
-			int crdr = 0;
-			for(size_t i=0; i<crdrVec.size(); i++){
-				if (crdrVec[i].GetCrdrDirection() == CCrdr::eSTRAIGHT){
-					crdr = (int)i;
-					break;
-				}
-			}
+		// no haltlines found, continue along the straight corridor
+		TCrdr* pCrdr = pFollow->pCrdr;
+		laneIdx = pCrdr->dstLnIdx;
+		TCrdrCntrlPnt* pLast = BindCrdrPnt( pCrdr->cntrlPntIdx + 
+											pCrdr->numCntrlPnt - 1 );
+		dist = BindRoad( BindLane( laneIdx )->roadId )->roadLengthLinear +
+					pLast->distance - pFollow->dist;
+		n++;
+	} else {
+		laneIdx = m_pLane->myId;
+		dist = m_pRoad->roadLengthLinear - GetDistanceOnLane();
+	}
 
-			// find the next lane & intersection
-			lane = crdrVec[crdr].GetDstntnLn();
-			if (!lane.IsValid()){
-				return CHldOfs();
-			}
-			intr = lane.GetNextIntrsctn();
-			if (!intr.IsValid()){
-				return CHldOfs();
-			}
+	// query the next few intersections for haltlines
+	while (n < lookahead){
+		const TLaneHldOfsLink& link = GetLaneHldOfsLink( laneIdx );
+		if (link.hldOfsCrdr != 0){
+			return link.hldOfsCrdr;
+		}
 
-			n++;
+		// no corridors in intersection
+		if (link.nextLane < 0){
+			return 0;
 		}
+
+		laneIdx = link.nextLane;
+		dist += link.nextDist;
+		n++;
 	}
 
 	// failed to find a suitable corridor with a haltline
-	return CHldOfs();
+	return 0;
 }
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -1753,7 +1663,7 @@ CRoadPos::GetDistance(int id) const
 		return m_dist;
 	else {
 
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
 			
 			if ( (id < 0) ||
@@ -1789,11 +1699,11 @@ CRoadPos::GetDistanceOnLane(int id) const
 
 	if (m_isRoad) {
 
-		CLane curLane = GetLane();
-		if ( curLane.GetDirection() == eNEG ) {
+		// read the lane and road directly; this is called every frame
+		// for every object, so avoid building CLane and CRoad objects
+		if ( m_pLane->direction == eNEG ) {
 
-			CRoad road = GetRoad();
-			return ( road.GetLinearLength() - m_dist );
+			return ( m_pRoad->roadLengthLinear - m_dist );
 
 		}
 		else {
@@ -1805,7 +1715,7 @@ CRoadPos::GetDistanceOnLane(int id) const
 	}
 	else {
 
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
 			
 			if ( (id < 0) ||
@@ -1841,35 +1751,28 @@ CRoadPos::GetLaneLength(int id) const {
 	AssertValid();
 
 	if (m_isRoad){
-		if (!GetLane().IsValid() || !GetLane().GetRoad().IsValid()){
-			return 0;
-		}
-		return GetLane().GetRoad().GetLinearLength();
+		return m_pRoad->roadLengthLinear;
 	} else {
-		CIntrsctn intr = GetIntrsctn();
-		if (!intr.IsValid()){
-			return 0;
-		}
-		TCrdrVec crdrVec;
-		intr.GetAllCrdrs(crdrVec);
-
-		if (crdrVec.size() == 0){
+		if (m_pIntrsctn->numOfCrdrs == 0){
 			return 0;
 		}
 
-		// search for corridor with matching id
+		// search for corridor with matching id; corridors are stored in
+		// order of their relative id, so it can be bound directly
+		int crdrId = 0;
 		if (id != -1){
-			for(size_t i=0; i<crdrVec.size(); i++){
-				if (crdrVec[i].GetRelativeId() == id){
-					return crdrVec[i].GetLength();
-				}
+			if (id < 0 || (TU32b)id >= m_pIntrsctn->numOfCrdrs){
+				// no corridor with matching ID found
+				return 0;
 			}
-			// no corridor with matching ID found
-			return 0;
+			crdrId = id;
 		}
 
-		// if no corridor found or if id == -1, return the first corridor's length by default
-		return crdrVec[0].GetLength();
+		// if id == -1, return the first corridor's length by default
+		TCrdr* pCrdr = BindCrdr(m_pIntrsctn->crdrIdx + crdrId);
+		TCrdrPnt* pLastPnt = BindCrdrPnt(pCrdr->cntrlPntIdx +
+										 pCrdr->numCntrlPnt - 1);
+		return pLastPnt->distance;
 	}
 }
 
@@ -1965,7 +1868,7 @@ CRoadPos::GetSplineOffset(int id, const CPath *cpPath, int* pCorrUsed ) const
 //////////////////////////////////////////////////////////////////////////////
 double	CRoadPos::ComputerCrdrOffset(int id, const CPath *cpPath,int* pCorrUsed) const{
 	if (!cpPath || !cpPath->IsValid() || id >= 0 || !cpPath->Contains(*this)){ 
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
 			if ( (id < 0) || //if id < 0, just pick the first one....
 				( (itr->pCrdr->myId - m_pIntrsctn->crdrIdx) == id) ){
@@ -1982,7 +1885,7 @@ double	CRoadPos::ComputerCrdrOffset(int id, const CPath *cpPath,int* pCorrUsed)
 		//can have multiple crdr, find the corridor that intersects the two sets
 		//since we already know the path contains our target we should have at 
 		//one crdr that intersects
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++) {
 			CVED::CRoad srcRoad(GetCved(), itr->pCrdr->srcRdIdx);
 			if (cpPath->GetCrdrFromIntrscn(m_pIntrsctn->myId,targCrd,NULL,itr->pCrdr->srcLnIdx - srcRoad.GetLaneIdx()))
@@ -2052,7 +1955,7 @@ CRoadPos::GetName(void) const
 		string in(pCharPool + m_pIntrsctn->nameIdx);
 		s = in + ':';
 		
-		vector<TCdo>::const_iterator cdo = m_cdo.begin();
+		TCdoVec::const_iterator cdo = m_cdo.begin();
 		char cr[10];
 		sprintf_s(cr, "%d", cdo->pCrdr->myId - m_pIntrsctn->crdrIdx);
 		
@@ -2130,7 +2033,7 @@ CRoadPos::GetAttribute(const int id, CAttr& attr) const
 		CIntrsctn isec = GetIntrsctn();
 
 		bitset<cCV_MAX_CRDRS> crdrs;
-		vector<TCdo>::const_iterator itr;
+		TCdoVec::const_iterator itr;
 		for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++)
 			crdrs.set(itr->pCrdr->myId - m_pIntrsctn->crdrIdx);
 
@@ -2303,12 +2206,12 @@ CRoadPos::GetVeryBestXYZ(bool useoffset) const
 		t = (m_dist - pCurCP->cummulativeLinDist) / 
 			/*(pCurCP->distToNextLinear)*/ 1;
 
-		relT = t/(pCurCP->distToNextLinear);
+		relT = t * GetRoadSegGeom(m_cntrlPntIdx).invLength;
 	} // If the current point is on a road
 
 	// If the current point is on an intersection
 	else {
-		vector<TCdo>::const_iterator cdo = m_cdo.begin();
+		TCdoVec::const_iterator cdo = m_cdo.begin();
 
 		TCrdrPnt* pCurCP = BindCrdrPnt(cdo->cntrlPntIdx);
 		TCrdrPnt* pNexCP = pCurCP+1;
@@ -2339,8 +2242,8 @@ CRoadPos::GetVeryBestXYZ(bool useoffset) const
 		// Find t
 		t = (cdo->dist - pCurCP->distance) /
 			/*(pNexCP->distance - pCurCP->distance)*/1;
-		relT = (cdo->dist - pCurCP->distance) /
-    			(pNexCP->distance - pCurCP->distance);
+		relT = (cdo->dist - pCurCP->distance) * 
+				GetCrdrSegGeom(cdo->cntrlPntIdx).invLength;
 
 	} // If the current point is on an intersection
 
@@ -2408,7 +2311,9 @@ CRoadPos::GetVeryBestXYZ(bool useoffset) const
 /// 	position, then GetXYZ is guaranteed to return the same point that was used.
 ///
 /// 	The road segment is assumed to be a straight line, and the resulting
-/// 	point is along the vector perpendicular to that line.
+/// 	point is along the vector perpendicular to that line.  The inverse
+/// 	length and the perpendicular vector of each segment are computed by
+/// 	CCved when the LRI file is loaded.
 ///
 ///\return The 3D point corresponding to the current road position.
 ///
@@ -2421,11 +2326,7 @@ CRoadPos::GetXYZ() const
 		return CPoint3D(0,0,0);
 	}
 	
-	double dx, dy;
-	CPoint3D curCPLoc, nexCPLoc;
-	CVector3D ortho;
 	double t;
-	CPoint3D pT;
 	double offset;
 	CPoint3D result;
 	
@@ -2433,91 +2334,60 @@ CRoadPos::GetXYZ() const
 	if (m_isRoad) {
 		TCntrlPnt* pCurCP = BindCntrlPnt(m_cntrlPntIdx);
 		TCntrlPnt* pNexCP = pCurCP+1;
-
-		curCPLoc.m_x = pCurCP->location.x;
-		curCPLoc.m_y = pCurCP->location.y;
-		curCPLoc.m_z = pCurCP->location.z;
-
-		nexCPLoc.m_x = pNexCP->location.x;
-		nexCPLoc.m_y = pNexCP->location.y;
-		nexCPLoc.m_z = pNexCP->location.z;
+		const TRoadSegGeom& seg = GetRoadSegGeom(m_cntrlPntIdx);
 
 		// Calculate the total offset of the point from 
 		//	the road segment
-		//int laneNo = m_pLane->laneNo;
-		//CRoadPos* const localThis = const_cast<CRoadPos* const>(this);
-		//localThis->m_pLane = BindLane(pCurCP->laneIdx + laneNo);
  		if ( ePOS == m_pLane->direction )
 			offset = m_ofs + m_pLane->offset;
 		else
 			offset = -m_ofs + m_pLane->offset;
 		
 		// Find t
-		t = (m_dist - pCurCP->cummulativeLinDist) / 
-			(pCurCP->distToNextLinear);
+		t = (m_dist - pCurCP->cummulativeLinDist) * seg.invLength;
 	
+		// The answer is the point on the road segment at t, moved 
+		//	by offset along the vector orthogonal to the segment
+		result.m_x = (1-t)*pCurCP->location.x + t*pNexCP->location.x + 
+						offset*seg.orthoI;
+		result.m_y = (1-t)*pCurCP->location.y + t*pNexCP->location.y +
+						offset*seg.orthoJ;
+		result.m_z = (1-t)*pCurCP->location.z + t*pNexCP->location.z;
 	} // If the current point is on a road
 	
 	// If the current point is on an intersection
 	else {
-		vector<TCdo>::const_iterator cdo = m_cdo.begin();
+		TCdoVec::const_iterator cdo = m_cdo.begin();
 		TCrdrPnt* pCurCP = BindCrdrPnt(cdo->cntrlPntIdx);
 		TCrdrPnt* pNexCP = pCurCP+1;
-#ifdef _DEBUG
-        TCrdrPnt debugP;
-        debugP.distance = 0;
-#endif
-		curCPLoc.m_x = pCurCP->location.x;
-		curCPLoc.m_y = pCurCP->location.y;		
-        nexCPLoc.m_x = pNexCP->location.x;
-		nexCPLoc.m_y = pNexCP->location.y;
+		const TCrdrSegGeom& seg = GetCrdrSegGeom(cdo->cntrlPntIdx);
 
 		// Offset is simply the offset from the
 		//	center of the corridor
 		offset = cdo->ofs;
 
 		// Find t
-		t = (cdo->dist - pCurCP->distance) /
-			(pNexCP->distance - pCurCP->distance);
-
-	} // If the current point is on an intersection
-
-	// Find slope of the line segment 
-	//	between the current CP
-	//	and the next CP
-	dx = curCPLoc.m_x - nexCPLoc.m_x;
-	dy = curCPLoc.m_y - nexCPLoc.m_y;
+		t = (cdo->dist - pCurCP->distance) * seg.invLength;
 
-	// Create a vector orthoganal to the 
-	//	line segment between the current CP
-	//	and the next CP
-	ortho.m_i = -dy;
-	ortho.m_j = dx;
-	ortho.m_k = 0.0;
-	ortho.Normalize();
+		result.m_x = (1-t)*pCurCP->location.x + t*pNexCP->location.x + 
+						offset*seg.orthoI;
+		result.m_y = (1-t)*pCurCP->location.y + t*pNexCP->location.y +
+						offset*seg.orthoJ;
+		result.m_z = 0.0;
 
-	// Find the point on the road segment at t
-	pT.m_x = (1-t)*curCPLoc.m_x + t*nexCPLoc.m_x;
-	pT.m_y = (1-t)*curCPLoc.m_y + t*nexCPLoc.m_y;
-	pT.m_z = (1-t)*curCPLoc.m_z + t*nexCPLoc.m_z;
+		const CTerrainGrid<Post>* pGrid = NULL;
+		if (!m_pIntrsctn->elevMap){
+			result.m_z =  m_pIntrsctn->elevation;
+		}else{
+			pGrid = GetIntrsctnGrid(m_pIntrsctn->myId);
+			Post gridOut;
+			if (pGrid->QueryElev(result, gridOut) )
+				result.m_z = gridOut.z;
+			else
+				result.m_z = m_pIntrsctn->elevation;
+		}
+	} // If the current point is on an intersection
 
-	// The answer is pT + offset*(ortho)
-	result.m_x = pT.m_x + offset*ortho.m_i;
-	result.m_y = pT.m_y + offset*ortho.m_j;
-	result.m_z = pT.m_z + offset*ortho.m_k;
-    if (!m_isRoad) {
-        const CTerrainGrid<Post>* pGrid = NULL;
-        if (!m_pIntrsctn->elevMap){
-            result.m_z =  m_pIntrsctn->elevation;
-        }else{
-            pGrid = GetIntrsctnGrid(m_pIntrsctn->myId);
-            Post gridOut;
-            if (pGrid->QueryElev(result, gridOut) )
-                result.m_z = gridOut.z;
-            else
-                result.m_z = m_pIntrsctn->elevation;
-        }
-    }
 	return result;
 
 } // end of GetXYZ
@@ -2564,8 +2434,8 @@ CRoadPos::GetTangentInterpolated(bool cubic) const
 		int factor = ((m_pLane->direction == ePOS)? 1 : -1);
 		TCntrlPnt* pNexCP = cntrlPnt+1;
 
-		double t = (m_dist - cntrlPnt->cummulativeLinDist) / 
-			(cntrlPnt->distToNextLinear);
+		double t = (m_dist - cntrlPnt->cummulativeLinDist) * 
+			GetRoadSegGeom(m_cntrlPntIdx).invLength;
 
 		if (cubic) {
 			tan1.m_i = factor*cntrlPnt->tangVecCubic.i;
@@ -2592,44 +2462,24 @@ CRoadPos::GetTangentInterpolated(bool cubic) const
 	}
 	else {
 		// Since the tangent is not stored in the corridor control 
-		// 	point, compute the linear tangent by subtracting the 
-		// 	position of the current control point from the position
-		// 	of the next control point, and normalize.
-		
+		// 	point, blend the chord from the current control point 
+		// 	with the following chord, and normalize.  The chords are
+		// 	computed by CCved when the LRI file is loaded.
 		const auto &crd = m_cdo.begin();
-		
-		TCrdrPnt *pCurCP = BindCrdrPnt((crd->cntrlPntIdx));
-		TCrdrPnt* pNexCP = pCurCP+1;
-		int currOffset = 1;
-		double curr_distance =  pNexCP->distance - pCurCP->distance;
-		int currCount =  crd->cntrlPntIdx - crd->pCrdr->cntrlPntIdx;
-		if (curr_distance < 10 &&  currCount < (int)crd->pCrdr->numCntrlPnt - 1){
-			pNexCP++;
-			currOffset++;
-		}
+		const TCrdrSegGeom& seg = GetCrdrSegGeom(crd->cntrlPntIdx);
 
-		tan1.m_i = pNexCP->location.x - pCurCP->location.x;
-		tan1.m_j = pNexCP->location.y - pCurCP->location.y;
+		tan1.m_i = seg.tan1I;
+		tan1.m_j = seg.tan1J;
 		tan1.m_k = 0.0;
-		//if we are not at the last control point, calculate the tan for the next 
-		//CP
-		
-		if ((int)crd->pCrdr->numCntrlPnt - 1> currCount + currOffset){ 
-			TCrdrPnt* pNexCP2 = pNexCP + 1;
-			curr_distance =  pNexCP->distance - pCurCP->distance;
-			currOffset++;
-			if (curr_distance < 10 &&  currCount + currOffset < (int)crd->pCrdr->numCntrlPnt - 1){
-				pNexCP2++;
-				currOffset++;
-			}
 
-			double t = (crd->dist - pCurCP->distance) / 
-				(pNexCP->distance - pCurCP->distance);
+		// if we are not at the last control point, blend in the tan 
+		// for the next CP
+		if (seg.hasTan2){ 
+			TCrdrPnt *pCurCP = BindCrdrPnt(crd->cntrlPntIdx);
+			double t = (crd->dist - pCurCP->distance) * seg.invTanLength;
 
-			
-
-			tan2.m_i = pNexCP2->location.x - pNexCP->location.x;
-			tan2.m_j = pNexCP2->location.y - pNexCP->location.y;
+			tan2.m_i = seg.tan2I;
+			tan2.m_j = seg.tan2J;
 			tan2.m_k = 0.0;
 
 			tan1.Scale(1-t);
@@ -2809,8 +2659,8 @@ CRoadPos::GetRightVecInterpolated(bool cubic) const
         TCntrlPnt* pNexCP = cntrlPnt+1;
 		int factor = ((m_pLane->direction == ePOS)? 1 : -1);
 
-		double t = (m_dist - cntrlPnt->cummulativeLinDist) / 
-			(cntrlPnt->distToNextLinear);
+		double t = (m_dist - cntrlPnt->cummulativeLinDist) * 
+			GetRoadSegGeom(m_cntrlPntIdx).invLength;
 
 		if (cubic) {
 			rht1.m_i = factor*cntrlPnt->rightVecCubic.i;
@@ -3120,8 +2970,8 @@ double	CRoadPos::GetCurvatureInterpolated(void) const{
 		int factor = ((m_pLane->direction == ePOS)? 1 : -1);
 		TCntrlPnt* pNexCP = cntrlPnt+1;
 
-		double t = (m_dist - cntrlPnt->cummulativeLinDist) / 
-			(cntrlPnt->distToNextLinear);
+		double t = (m_dist - cntrlPnt->cummulativeLinDist) * 
+			GetRoadSegGeom(m_cntrlPntIdx).invLength;
 
 		TCntrlPnt* pCntrlPnt = BindCntrlPnt(m_cntrlPntIdx);
 		double current = fabs(pCntrlPnt->radius);
@@ -3290,7 +3140,7 @@ CRoadPos::operator==(const CRoadPos& cRhs) const
 		if (m_pIntrsctn->myId == cRhs.m_pIntrsctn->myId) {
 
 			// For each corridor in the vector
-			vector<TCdo>::const_iterator itrC, itrP;
+			TCdoVec::const_iterator itrC, itrP;
 			for (itrC = m_cdo.begin(), itrP = cRhs.m_cdo.begin();
 				 ( (itrC != m_cdo.end()) && (itrP != cRhs.m_cdo.end()) );
 				 itrC++, itrP++) {
@@ -3601,10 +3451,11 @@ CRoadPos::SetDistance( double dist )
 	else {
 		// Find the control point associated with the 
 		// 	given distance along the corridor.
-		vector<TCdo>::iterator cdo = m_cdo.begin();
+		TCdoVec::iterator cdo = m_cdo.begin();
 
 		cdo->dist = dist;
-		cdo->cntrlPntIdx = Search(dist) + 
+		cdo->cntrlPntIdx = Search(dist, cdo->pCrdr,
+				cdo->cntrlPntIdx - cdo->pCrdr->cntrlPntIdx) +
 			cdo->pCrdr->cntrlPntIdx;
 
 		TCrdrPnt* pLastCrdrPnt = BindCrdrPnt(cdo->pCrdr->cntrlPntIdx +
@@ -3648,7 +3499,8 @@ CRoadPos::IncrDistance( double dist )
 
 		// Find the control point associated with the 
 		// 	given distance along the road.
-		m_cntrlPntIdx = m_pRoad->cntrlPntIdx + Search(m_dist);
+		m_cntrlPntIdx = m_pRoad->cntrlPntIdx +
+			Search(m_dist, 0, m_cntrlPntIdx - m_pRoad->cntrlPntIdx);
 	
 		TCntrlPnt* pCurCP = BindCntrlPnt(m_cntrlPntIdx);
 		int laneNo = m_pLane->laneNo;
@@ -3660,10 +3512,11 @@ CRoadPos::IncrDistance( double dist )
 			return eWITHIN_ROAD;
 	}
 	else {
-		vector<TCdo>::iterator cdo = m_cdo.begin();
+		TCdoVec::iterator cdo = m_cdo.begin();
 
 		cdo->dist += dist;
-		cdo->cntrlPntIdx = Search(cdo->dist) + 
+		cdo->cntrlPntIdx = Search(cdo->dist, cdo->pCrdr,
+				cdo->cntrlPntIdx - cdo->pCrdr->cntrlPntIdx) +
 			cdo->pCrdr->cntrlPntIdx;
 
 		// Find the control point associated with the 
@@ -3709,7 +3562,8 @@ CRoadPos::DecrDistance( double dist )
 			m_dist += dist;
 
 		// Find the control point associated with the given distance along the road.
-		m_cntrlPntIdx = m_pRoad->cntrlPntIdx + Search(m_dist);
+		m_cntrlPntIdx = m_pRoad->cntrlPntIdx +
+			Search(m_dist, 0, m_cntrlPntIdx - m_pRoad->cntrlPntIdx);
 	
 		TCntrlPnt* pCurCP = BindCntrlPnt( m_cntrlPntIdx );
 		int laneNo = m_pLane->laneNo;
@@ -3722,10 +3576,11 @@ CRoadPos::DecrDistance( double dist )
 	}
 	else 
 	{
-		vector<TCdo>::iterator cdo = m_cdo.begin();
+		TCdoVec::iterator cdo = m_cdo.begin();
 
 		cdo->dist -= dist;
-		cdo->cntrlPntIdx = cdo->pCrdr->cntrlPntIdx + Search(cdo->dist);
+		cdo->cntrlPntIdx = cdo->pCrdr->cntrlPntIdx + Search(cdo->dist,
+				cdo->pCrdr, cdo->cntrlPntIdx - cdo->pCrdr->cntrlPntIdx);
 
 		// Find the control point associated with the given distance along the corridor.
 		TCrdrPnt* pLastCrdrPnt = BindCrdrPnt(cdo->pCrdr->cntrlPntIdx + cdo->pCrdr->numCntrlPnt - 1);
@@ -3763,7 +3618,7 @@ CRoadPos::SetOffset( double offset )
 		//
 		// Set all of the corridors' offsets.
 		//
-		vector<TCdo>::iterator i;
+		TCdoVec::iterator i;
 		for ( i = m_cdo.begin(); i != m_cdo.end(); i++ ) {
 			(m_cdo.begin())->ofs = offset;
 		}
@@ -4010,29 +3865,21 @@ CRoadPos::SetString( const string& cName )
     m_ofs = atof(pTok);
 	delete [] pBuf;
 
-	THeader*	pH   = static_cast<THeader*>(GetInst());
-	char* pCharPool	= static_cast<char*>(GetInst()) + pH->charOfs;
-	unsigned int i;
+	// Look the name up in the name index of CVED; road names take
+	// precedence over intersection names.
+	int roadId = GetCved().GetRoadIdByName(strName);
 
 	m_isRoad = true;
-	for (i = 1; i < pH->roadCount; i++){
-		m_pRoad = BindRoad(i);
-		if ( strName == (pCharPool + m_pRoad->nameIdx) )
-			break;
-	}
 
 	// If there's no road with this name, then try the intrsctn pool.
-	if (i == pH->roadCount) {
+	if (roadId == 0) {
+		int intrsctnId = GetCved().GetIntrsctnIdByName(strName);
+
 		m_pRoad = 0;
 		m_pLane = 0;
 		m_isRoad = false;
-	
-		for (i = 1; i < pH->intrsctnCount; i++){
-			m_pIntrsctn = BindIntrsctn(i);
-			if ( strName == (pCharPool + m_pIntrsctn->nameIdx) )
-				break;
-		}
-		if (i == pH->intrsctnCount) {
+
+		if (intrsctnId == 0) {
 			// There's no road or intrsctn by this name, 
 			// 	so return false.
 			m_pIntrsctn = 0;
@@ -4043,6 +3890,8 @@ CRoadPos::SetString( const string& cName )
 		else {
 			TCdo tmpCdo;
 
+			m_pIntrsctn = BindIntrsctn(intrsctnId);
+
 			tmpCdo.dist = m_dist;
 			tmpCdo.ofs = m_ofs;
 
@@ -4061,6 +3910,7 @@ CRoadPos::SetString( const string& cName )
 
 	// Valid road found, so set up lane.
 	else {
+		m_pRoad = BindRoad(roadId);
 		m_pLane = BindLane(m_pRoad->laneIdx + id);
 	
 		// Find the control point associated with the 
@@ -4219,7 +4069,8 @@ CRoadPos::Travel(double dist, const CLane* cpDstLane, const ETravelTurnDir eTurn
 	
 		// Find the control point associated with the 
 		// 	given distance along the road.
-		m_cntrlPntIdx = Search(m_dist) + m_pRoad->cntrlPntIdx;
+		m_cntrlPntIdx = Search(m_dist, 0, m_cntrlPntIdx - m_pRoad->cntrlPntIdx)
+			+ m_pRoad->cntrlPntIdx;
 		TCntrlPnt* pCurCP = BindCntrlPnt(m_cntrlPntIdx);
 		m_pLane = BindLane(pCurCP->laneIdx + m_pLane->laneNo);
 		
@@ -4313,7 +4164,7 @@ CRoadPos::Travel(double dist, const CLane* cpDstLane, const ETravelTurnDir eTurn
 	else {
 
 		// Increment the distance on the current corridor
-		vector<TCdo>::iterator cdo = m_cdo.begin();
+		TCdoVec::iterator cdo = m_cdo.begin();
 
 		// tries to handle case when Travel() is supplied a CRoadPos that begins on an intersection (need to find the correct corridor first)
 		if (cpDstLane != 0 && m_cdo.size() > 1 || m_cdo.size() == 0){
@@ -4379,7 +4230,8 @@ CRoadPos::Travel(double dist, const CLane* cpDstLane, const ETravelTurnDir eTurn
 		cdo->dist += dist;
 
 		// get the index of the point; used in GetVeryBestXYZ()
-		cdo->cntrlPntIdx = Search(cdo->dist, cdo->pCrdr) + cdo->pCrdr->cntrlPntIdx;
+		cdo->cntrlPntIdx = Search(cdo->dist, cdo->pCrdr,
+				cdo->cntrlPntIdx - cdo->pCrdr->cntrlPntIdx) + cdo->pCrdr->cntrlPntIdx;
 
 		// If distance is within the corridor
 		if ( (cdo->dist >= 0) &&
@@ -4509,7 +4361,8 @@ CRoadPos::TravelDir(double dist, const ETravelTurnDir eTurnDir, const int idx)
 	
 		// Find the control point associated with the 
 		// 	given distance along the road.
-		m_cntrlPntIdx = Search(m_dist) + m_pRoad->cntrlPntIdx;
+		m_cntrlPntIdx = Search(m_dist, 0, m_cntrlPntIdx - m_pRoad->cntrlPntIdx)
+			+ m_pRoad->cntrlPntIdx;
 		TCntrlPnt* pCurCP = BindCntrlPnt(m_cntrlPntIdx);
 		m_pLane = BindLane(pCurCP->laneIdx + m_pLane->laneNo);
 		
@@ -4564,7 +4417,7 @@ CRoadPos::TravelDir(double dist, const ETravelTurnDir eTurnDir, const int idx)
 	else {
 
 		// Increment the distance on the current corridor
-		vector<TCdo>::iterator cdo = m_cdo.begin();
+		TCdoVec::iterator cdo = m_cdo.begin();
 
 		// tries to handle case when Travel() is supplied a CRoadPos that begins on an intersection (need to find the correct corridor first)
 		if (idx != -1 && (idx != cdo->pCrdr->srcLnIdx || cdo->pCrdr->direction != eTurnDir) ){
@@ -4624,7 +4477,8 @@ CRoadPos::TravelDir(double dist, const ETravelTurnDir eTurnDir, const int idx)
 		cdo->dist += dist;
 
 		// get the index of the point; used in GetVeryBestXYZ()
-		cdo->cntrlPntIdx = Search(cdo->dist, cdo->pCrdr) + cdo->pCrdr->cntrlPntIdx;
+		cdo->cntrlPntIdx = Search(cdo->dist, cdo->pCrdr,
+				cdo->cntrlPntIdx - cdo->pCrdr->cntrlPntIdx) + cdo->pCrdr->cntrlPntIdx;
 
 		// If distance is within the corridor
 		if ( (cdo->dist >= 0) &&
@@ -4752,7 +4606,8 @@ CRoadPos::TravelCrdr(double dist, const int crdrId)
 	
 		// Find the control point associated with the 
 		// 	given distance along the road.
-		m_cntrlPntIdx = Search(m_dist) + m_pRoad->cntrlPntIdx;
+		m_cntrlPntIdx = Search(m_dist, 0, m_cntrlPntIdx - m_pRoad->cntrlPntIdx)
+			+ m_pRoad->cntrlPntIdx;
 		TCntrlPnt* pCurCP = BindCntrlPnt(m_cntrlPntIdx);
 		m_pLane = BindLane(pCurCP->laneIdx + m_pLane->laneNo);
 		
@@ -4824,7 +4679,7 @@ CRoadPos::TravelCrdr(double dist, const int crdrId)
 	else {
 
 		// Increment the distance on the current corridor
-		vector<TCdo>::iterator cdo = m_cdo.begin();
+		TCdoVec::iterator cdo = m_cdo.begin();
 
 		// tries to handle case when Travel() is supplied a CRoadPos that begins on an intersection (need to find the correct corridor first)
 		if (GetCorridor(crdrId).IsValid() && cdo->pCrdr->myId != GetCorridor(crdrId).GetId()){
@@ -4876,7 +4731,8 @@ CRoadPos::TravelCrdr(double dist, const int crdrId)
 		cdo->dist += dist;
 
 		// get the index of the point; used in GetVeryBestXYZ()
-		cdo->cntrlPntIdx = Search(cdo->dist, cdo->pCrdr) + cdo->pCrdr->cntrlPntIdx;
+		cdo->cntrlPntIdx = Search(cdo->dist, cdo->pCrdr,
+				cdo->cntrlPntIdx - cdo->pCrdr->cntrlPntIdx) + cdo->pCrdr->cntrlPntIdx;
 
 		// If distance is within the corridor
 		if ( (cdo->dist >= 0) &&
@@ -5158,7 +5014,8 @@ CRoadPos::FindNext(bitset<cCV_NUM_ATTR_CHANGE>& posMask)
 
 		// Find the control point associated with the 
 		// 	given distance along the road.
-		m_cntrlPntIdx = Search(m_dist) + m_pRoad->cntrlPntIdx;
+		m_cntrlPntIdx = Search(m_dist, 0, m_cntrlPntIdx - m_pRoad->cntrlPntIdx)
+			+ m_pRoad->cntrlPntIdx;
 		TCntrlPnt* pCurCP = BindCntrlPnt(m_cntrlPntIdx);
 		int laneNo = m_pLane->laneNo;
 		m_pLane = BindLane(pCurCP->laneIdx + laneNo);
@@ -5196,10 +5053,12 @@ CRoadPos::SetXYZ(
 			bool* pColdSearch
 			) 
 {
-	vector<TSegment> segments;
+	TSearchScratch& scratch = GetSearchScratch();
+	vector<TSegment>& segments = scratch.segments;
 	TSegment tmpSeg;
 	bool found = false;
 
+	segments.clear();
 	if( pColdSearch )  *pColdSearch = false;
 
 	// If the current CRoadPos contains valid data, then
@@ -5236,8 +5095,11 @@ CRoadPos::SetXYZ(
 		tmpSeg.isRoad = false;
 		tmpSeg.pIntrsctn = m_pIntrsctn;
 
-		vector<TCdo>::const_iterator pCdo;
-		vector<TCdo> tmpCdo = m_cdo;
+		// FindPoint rebuilds m_cdo, so move the previous corridor
+		// 	positions to the scratch vector first
+		TCdoVec::const_iterator pCdo;
+		TCdoVec& tmpCdo = scratch.cdo;
+		tmpCdo.swap( m_cdo );
 		m_cdo.clear();
 		for( pCdo = tmpCdo.begin(); pCdo != tmpCdo.end(); pCdo++ ) 
 		{
@@ -5266,7 +5128,8 @@ CRoadPos::SetXYZ(
 	{
 		if( pColdSearch )  *pColdSearch = true;
 
-		vector<int> quadTreeIds;
+		vector<int>& quadTreeIds = scratch.quadTreeIds;
+		vector<int>& pnts = scratch.cntrlPnts;
 
 		///////////////////////////////////////////////////////////////
 		// Get the roadpieces overlapping the point
@@ -5275,6 +5138,7 @@ CRoadPos::SetXYZ(
 		TRoad* pRoadPool = BindRoad( 0 );
 		TRoadPiece* pRoadPiecePool = BindRoadPiece( 0 );
 
+		quadTreeIds.clear();
 		GetCved().SearchRdPcQuadTree(
 							cPoint.m_x,
 							cPoint.m_y,
@@ -5314,22 +5178,22 @@ CRoadPos::SetXYZ(
 			tmpSeg.isRoad = false;
 			tmpSeg.pCrdr = &pCrdrPool[cpCrdr->GetId()];
 			tmpSeg.pIntrsctn = &pIsecPool[cpCrdr->GetIntrsctnId()];
-            CCved::TIntVec pnts;
-            GetCved().GetCrdrsCntrlPointsNear(cPoint,cpCrdr->GetId(),pnts);
 
-            for (unsigned int i = 0; i < pnts.size(); i++){
-                tmpSeg.begCntrlPntIdx = pnts[i];
-                tmpSeg.endCntrlPntIdx = pnts[i]+1;
-			    segments.push_back( tmpSeg );
-            }
+			pnts.clear();
+			GetCved().GetCrdrsCntrlPointsNear(cPoint,cpCrdr->GetId(),pnts);
+
+			for (unsigned int i = 0; i < pnts.size(); i++){
+				tmpSeg.begCntrlPntIdx = pnts[i];
+				tmpSeg.endCntrlPntIdx = pnts[i]+1;
+				segments.push_back( tmpSeg );
+			}
 		} // if a corridor was given
 
 		// If no corridor was given, do a cold search on the intersection
 		// 	quad tree.
 		else 
 		{
-			// Note that this line may be deleted, once Concurrent 
-			// 	fixes the STL set<>::clear() method.
+			quadTreeIds.clear();
 			GetCved().SearchIntrsctnQuadTree(
 								cPoint.m_x,
 								cPoint.m_y,
@@ -5337,46 +5201,38 @@ CRoadPos::SetXYZ(
 								cPoint.m_y,
 								quadTreeIds
 								);
-  //      
-			TIntrsctn* pIntrsctn = pIsecPool;
-			TCrdr* pCrdrPool = BindCrdr( 0 );
-			TCrdr* pCrdr = pCrdrPool;
+
+			TIntrsctn* pIntrsctn;
 			int crdrItr, startCrdrId, endCrdrId;
+
 			// For each intrsctn in result
 			for( cItr = quadTreeIds.begin(); cItr != quadTreeIds.end(); cItr++ )
 			{	
-				// Add a segment for each corridor
+				// The quadtree only tests the bounding box, so use the 
+				// 	border cached by CCved to discard the intersection
+				// 	if the point is outside of it.
+				if( !GetIntrsctnBorder( *cItr ).Contains( cPoint ) )
+					continue;
+
+				// Add a segment for each corridor control point whose
+				// 	bounding box contains the point
 				pIntrsctn = &pIsecPool[*cItr];
+				startCrdrId = pIntrsctn->crdrIdx;
+				endCrdrId = startCrdrId + pIntrsctn->numOfCrdrs;
 
-				try {
-					CVED::CIntrsctn intObj(GetCved(),*cItr);
-					CPolygon2D border;
-					intObj.GetBorder(border);
-					if (border.Contains(cPoint))
-					{
-						startCrdrId = pIntrsctn->crdrIdx;
-						endCrdrId = startCrdrId + pIntrsctn->numOfCrdrs;
-						for(
-							crdrItr = startCrdrId, 
-				 			pCrdr = &pCrdrPool[crdrItr];
-				 			crdrItr < endCrdrId;
-				 			crdrItr++, pCrdr++
-							)
-						{	
-							tmpSeg.isRoad = false;
-							tmpSeg.pCrdr = pCrdr;
-							tmpSeg.pIntrsctn = pIntrsctn;
-                            CCved::TIntVec pnts;
-                            GetCved().GetCrdrsCntrlPointsNear(cPoint,pCrdr->myId,pnts);
-                            for (unsigned int i = 0; i < pnts.size(); i++){
-                                tmpSeg.begCntrlPntIdx = pnts[i];
-                                tmpSeg.endCntrlPntIdx = pnts[i]+1;
-                                segments.push_back( tmpSeg );
-                            }
-						}
+				tmpSeg.isRoad = false;
+				tmpSeg.pIntrsctn = pIntrsctn;
+				for( crdrItr = startCrdrId; crdrItr < endCrdrId; crdrItr++ )
+				{	
+					tmpSeg.pCrdr = &pCrdrPool[crdrItr];
+
+					pnts.clear();
+					GetCved().GetCrdrsCntrlPointsNear(cPoint,crdrItr,pnts);
+					for (unsigned int i = 0; i < pnts.size(); i++){
+						tmpSeg.begCntrlPntIdx = pnts[i];
+						tmpSeg.endCntrlPntIdx = pnts[i]+1;
+						segments.push_back( tmpSeg );
 					}
-				} catch (cvCInternalError) {
-					// skip over problematic intersections
 				}
 			} // For each intrsctn in result
 		} // If no corridor was given
@@ -5417,6 +5273,28 @@ CRoadPos::SetXYZ(
 
 } // end of SetXYZ
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetSearchScratch (private)
+// 	Returns the buffers used by SetXYZ to assemble the segments to search.
+//
+// Remarks: The buffers keep their capacity from one call to the next, so
+// 	after the first few searches SetXYZ no longer allocates memory.  Each
+// 	thread has its own set of buffers.
+//
+// Arguments:
+//
+// Returns: A reference to the buffers of the calling thread.
+//
+//////////////////////////////////////////////////////////////////////////////
+CRoadPos::TSearchScratch&
+CRoadPos::GetSearchScratch(void)
+{
+	static thread_local TSearchScratch sScratch;
+
+	return sScratch;
+} // end of GetSearchScratch
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description: SetXY
@@ -5506,8 +5384,8 @@ CRoadPos::SetXY(
 		tmpSeg.isRoad = false;
 		tmpSeg.pIntrsctn = m_pIntrsctn;
 
-		vector<TCdo> tmpCdoVec = m_cdo;
-		vector<TCdo>::const_iterator pCdo;
+		TCdoVec tmpCdoVec = m_cdo;
+		TCdoVec::const_iterator pCdo;
 		m_cdo.clear();
 		for( 
 			pCdo = tmpCdoVec.begin(); 
@@ -5666,6 +5544,66 @@ CRoadPos::SetXY(
 //		Protected functions
 //////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SearchCntrlPnts (local)
+// 	Finds the control point of a road or corridor that precedes a distance.
+//
+// Remarks: The control points are searched starting from a cursor, which is
+// 	the index found by the previous search on the same road or corridor.
+// 	Positions move by small amounts from one frame to the next, so the
+// 	answer is almost always the cursor itself or one of its neighbors.  If
+// 	it is not found within cMAX_CURSOR_STEPS steps, or if there is no
+// 	cursor, a binary search is performed instead.  Both return the same
+// 	index.
+//
+// Arguments:
+// 	pCp - the first control point
+// 	numCntrlPnt - the number of control points
+// 	dist - distance along the road or corridor to search
+// 	cursor - index of the control point found by the previous search, or
+// 		-1 if there is none
+//
+// Returns: The index of the control point, relative to the first one.
+//
+//////////////////////////////////////////////////////////////////////////////
+const int cMAX_CURSOR_STEPS = 8;
+
+template<class TPnt>
+static int
+SearchCntrlPnts(const TPnt* pCp, int numCntrlPnt, double dist, int cursor)
+{
+	int last = numCntrlPnt - 2;		// start of the last segment
+	if (last <= 0)
+		return 0;
+
+	if (cursor >= 0 && cursor <= last) {
+		int steps;
+		for (steps = 0; steps < cMAX_CURSOR_STEPS; steps++) {
+			if (cursor < last && dist >= (pCp+cursor+1)->distance)
+				cursor++;
+			else if (cursor > 0 && dist < (pCp+cursor)->distance)
+				cursor--;
+			else
+				return cursor;
+		}
+	}
+
+	int			begin   = 0;
+	int			end     = numCntrlPnt - 1;
+	int			middle  = (begin+end)/2;
+
+	while(middle!=begin){
+		if ( dist < (pCp+middle)->distance )
+			end = middle;
+		else
+			begin = middle;
+		middle = (begin+end)/2;
+	}
+
+	return begin;
+} // end of SearchCntrlPnts
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Description: Search (protected)
@@ -5677,9 +5615,16 @@ CRoadPos::SetXY(
 // 	control points are searched.  Otherwise, the crdr cntrl points are 
 // 	searched.
 //
+// 	Functions that move the position along the same road or corridor, such
+// 	as Travel and IncrDistance, pass the current control point as the
+// 	cursor, which makes the search constant time for small moves.
+//
 // Arguments:
 // 	dist - distance along current road or corridor to search
 // 	cpCrdr - optional parameter, if specified, then search along that corridor.
+// 	cursor - optional parameter, index of the control point found by the
+// 		previous search on the same road or corridor, relative to its first
+// 		control point.  The default value is -1, meaning there is none.
 //
 // Returns: A number representing the index to right control point containing 
 // 	the lane/crdr control point index with respect to the road/crdr
@@ -5687,7 +5632,8 @@ CRoadPos::SetXY(
 //////////////////////////////////////////////////////////////////////////////
 int
 CRoadPos::Search(double dist, 
-				 const TCrdr* cpCrdr) const
+				 const TCrdr* cpCrdr,
+				 int cursor) const
 {
 #ifdef _DEBUG
 	cvTRoad tempcv; //for the debugger
@@ -5698,23 +5644,9 @@ CRoadPos::Search(double dist,
 
 		AssertValid();
 
-		int			numOfCntrlPt = m_pRoad->numCntrlPnt;
-		int			cntrlPntIdx = m_pRoad->cntrlPntIdx;
-		TCntrlPnt*	pCp  =  BindCntrlPnt(cntrlPntIdx);
+		TCntrlPnt*	pCp  =  BindCntrlPnt(m_pRoad->cntrlPntIdx);
 
-		int			begin   = 0;
-		int			end     = numOfCntrlPt - 1;
-		int			middle  = (begin+end)/2;;
-
-		while(middle!=begin){
-			if ( dist < (pCp+middle)->distance )
-				end = middle;
-			else
-				begin = middle;
-			middle = (begin+end)/2;
-		}
-
-		return begin;
+		return SearchCntrlPnts(pCp, m_pRoad->numCntrlPnt, dist, cursor);
 	}
 	// Search crdr if on intrsctn
 	else {
@@ -5723,23 +5655,9 @@ CRoadPos::Search(double dist,
 			cpCrdr = m_cdo.begin()->pCrdr;
 		}
 
-		int			numOfCntrlPt = cpCrdr->numCntrlPnt;
-		int			cntrlPntIdx = cpCrdr->cntrlPntIdx;
-		TCrdrPnt*	pCp  =  BindCrdrPnt(cntrlPntIdx);
-
-		int			begin   = 0;
-		int			end     = numOfCntrlPt - 1;
-		int			middle  = (begin+end)/2;;
-
-		while(middle!=begin){
-			if ( dist < (pCp+middle)->distance )
-				end = middle;
-			else
-				begin = middle;
-			middle = (begin+end)/2;
-		}
+		TCrdrPnt*	pCp  =  BindCrdrPnt(cpCrdr->cntrlPntIdx);
 
-		return begin;
+		return SearchCntrlPnts(pCp, cpCrdr->numCntrlPnt, dist, cursor);
 	}
 } // end of Search
 
@@ -6774,7 +6692,7 @@ bool CRoadPos::SetCrdPriority(int crdrId){
 		}
 		//now we need to see if we have the element
 		//unsigned int cnt = m_cdo.size();
-		vector<TCdo>::iterator itr;
+		TCdoVec::iterator itr;
 		itr = m_cdo.begin();
 
 		for (; itr !=  m_cdo.end(); itr++){
@@ -6820,7 +6738,7 @@ bool CRoadPos::SetCrdPriorityByDir(CCrdr::ECrdrDirection dir){
 		}
 		//now we need to see if we have the element
 		//unsigned int cnt = m_cdo.size();
-		vector<TCdo>::iterator itr;
+		TCdoVec::iterator itr;
 		itr = m_cdo.begin();
 
 		for (; itr !=  m_cdo.end(); itr++){
@@ -6891,7 +6809,7 @@ CRoadPos::GetSpeedLimit(int id) const
 		/*
         CIntrsctn intrsctn = GetIntrsctn();
         bitset<cCV_MAX_CRDRS> crdrs;
-        vector<TCdo>::const_iterator itr;
+        TCdoVec::const_iterator itr;
         for (itr = m_cdo.begin(); itr != m_cdo.end(); itr++){
             crdrs.set(itr->pCrdr->myId - m_pIntrsctn->crdrIdx);
 		}
@@ -0,0 +1,1107 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version: 		$Id: routegraph.cxx,v 1.1 $
+//
+// Author(s):
+// Date:
+//
+// Description:	The implementation of the CRouteGraph class
+//
+//////////////////////////////////////////////////////////////////////////////
+#include "cvedpub.h"
+#include "routegraph.h"
+#include "cvedstrc.h"		// private CVED data structs
+
+#include <queue>
+#include <limits>
+#include <algorithm>
+
+namespace CVED {
+
+// maximum number of shortest route trees kept by the route cache
+const int cMAX_ROUTE_TREES = 64;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: CRouteGraph
+// 	Default constructor creates an empty graph.
+//
+// Remarks:
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+CRouteGraph::CRouteGraph()
+{
+	Clear();
+} // end of CRouteGraph
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Clear
+// 	Removes all nodes and edges from the graph.
+//
+// Remarks:
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CRouteGraph::Clear()
+{
+	m_edges.clear();
+	m_firstEdge.assign( 1, 0 );
+	m_inEdges.clear();
+	m_firstInEdge.assign( 1, 0 );
+	m_entryX.clear();
+	m_entryY.clear();
+	m_pHierNodes = 0;
+	m_numHierNodes = 0;
+	m_pHierEdges = 0;
+	ClearRouteCache();
+} // end of Clear
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SetNumRoads
+// 	Sets the number of roads, including the invalid road 0, and so the
+// 	number of nodes of the graph.
+//
+// Remarks: This function should be called before any other function that
+// 	builds the graph.
+//
+// Arguments:
+// 	numRoads - number of slots in the road pool
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CRouteGraph::SetNumRoads( int numRoads )
+{
+	Clear();
+	m_entryX.assign( 2 * numRoads, 0.0 );
+	m_entryY.assign( 2 * numRoads, 0.0 );
+} // end of SetNumRoads
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SetRoadEnds
+// 	Stores the first and last control points of a road.
+//
+// Remarks: A road traveled in the positive direction is entered at its
+// 	first control point, and at its last control point otherwise.  These
+// 	points are used to estimate the remaining distance during a search.
+//
+// Arguments:
+// 	roadId - identifier of the road
+// 	firstX, firstY - location of the first control point
+// 	lastX, lastY - location of the last control point
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CRouteGraph::SetRoadEnds(
+			int roadId,
+			double firstX, double firstY,
+			double lastX, double lastY
+			)
+{
+	int posNode = GetNode( roadId, ePOS );
+	int negNode = GetNode( roadId, eNEG );
+
+	m_entryX[posNode] = firstX;
+	m_entryY[posNode] = firstY;
+	m_entryX[negNode] = lastX;
+	m_entryY[negNode] = lastY;
+} // end of SetRoadEnds
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: AddEdge
+// 	Adds a corridor to the graph.
+//
+// Remarks: Finalize must be called after the last edge is added.
+//
+// Arguments:
+// 	cEdge - the corridor to add
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CRouteGraph::AddEdge( const TEdge& cEdge )
+{
+	m_edges.push_back( cEdge );
+} // end of AddEdge
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: Finalize
+// 	Groups the edges by their source node, and builds the index of the
+// 	edges by target node used by backward searches.
+//
+// Remarks: The sort is stable, so the edges leaving a node keep the order in
+// 	which they were added.  Route searches visit the corridors of an
+// 	intersection in the same order as CIntrsctn::GetCrdrsStartingFrom.
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CRouteGraph::Finalize()
+{
+	int numNodes = (int)m_entryX.size();
+
+	stable_sort(
+		m_edges.begin(),
+		m_edges.end(),
+		[]( const TEdge& a, const TEdge& b ) {
+			return GetNode( a.srcRoad, a.srcDir ) < GetNode( b.srcRoad, b.srcDir );
+		}
+		);
+
+	m_firstEdge.assign( numNodes + 1, 0 );
+	vector<TEdge>::const_iterator itr;
+	for( itr = m_edges.begin(); itr != m_edges.end(); itr++ )
+	{
+		m_firstEdge[GetNode( itr->srcRoad, itr->srcDir ) + 1]++;
+	}
+	for( int node = 0; node < numNodes; node++ )
+	{
+		m_firstEdge[node + 1] += m_firstEdge[node];
+	}
+
+	m_firstInEdge.assign( numNodes + 1, 0 );
+	for( itr = m_edges.begin(); itr != m_edges.end(); itr++ )
+	{
+		m_firstInEdge[GetNode( itr->dstRoad, itr->dstDir ) + 1]++;
+	}
+	for( int node = 0; node < numNodes; node++ )
+	{
+		m_firstInEdge[node + 1] += m_firstInEdge[node];
+	}
+
+	m_inEdges.assign( m_edges.size(), 0 );
+	vector<int> nextSlot( m_firstInEdge.begin(), m_firstInEdge.end() - 1 );
+	for( int e = 0; e < (int)m_edges.size(); e++ )
+	{
+		int node = GetNode( m_edges[e].dstRoad, m_edges[e].dstDir );
+		m_inEdges[nextSlot[node]++] = e;
+	}
+
+	ClearRouteCache();
+} // end of Finalize
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SetHierarchy
+// 	Attaches the route hierarchy precomputed by the lri compiler.
+//
+// Remarks: The hierarchy is ignored if it does not have one node per road
+// 	and direction, plus the extra node that ends the edge lists, which
+// 	happens when it was computed for a different road pool.  The pools
+// 	are not copied and must remain valid as long as the graph is used.
+//
+// Arguments:
+// 	pNodes - the route hierarchy node pool
+// 	numNodes - number of entries in the node pool
+// 	pEdges - the route hierarchy edge pool
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CRouteGraph::SetHierarchy(
+			const cvTRouteHierNode* pNodes,
+			int numNodes,
+			const cvTRouteHierEdge* pEdges
+			)
+{
+	if( pNodes == 0 || pEdges == 0 || numNodes != (int)m_entryX.size() + 1 )
+	{
+		m_pHierNodes = 0;
+		m_numHierNodes = 0;
+		m_pHierEdges = 0;
+		return;
+	}
+
+	m_pHierNodes = pNodes;
+	m_numHierNodes = numNodes;
+	m_pHierEdges = pEdges;
+} // end of SetHierarchy
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: IsEmpty
+// 	Indicates if the graph has any edges.
+//
+// Remarks:
+//
+// Arguments:
+//
+// Returns: True if the graph has no edges, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CRouteGraph::IsEmpty() const
+{
+	return m_edges.empty();
+} // end of IsEmpty
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: HasHierarchy
+// 	Indicates if a route hierarchy is available.
+//
+// Remarks:
+//
+// Arguments:
+//
+// Returns: True if shortest routes are found using the route hierarchy,
+// 	false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CRouteGraph::HasHierarchy() const
+{
+	return m_pHierNodes != 0;
+} // end of HasHierarchy
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: ClearRouteCache
+// 	Discards the shortest route trees built so far.
+//
+// Remarks: CCved calls this function whenever road or corridor attributes
+// 	change, since the routes stored in the trees may no longer be valid.
+//
+// Arguments:
+//
+// Returns: void
+//
+//////////////////////////////////////////////////////////////////////////////
+void
+CRouteGraph::ClearRouteCache()
+{
+	lock_guard<mutex> guard( m_routeTreeLock );
+	m_routeTrees.clear();
+	m_routeTreeOrder.clear();
+} // end of ClearRouteCache
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetNode (private)
+// 	Returns the node that represents a road traveled in a direction.
+//
+// Remarks:
+//
+// Arguments:
+// 	roadId - identifier of the road
+// 	dir - direction of travel
+//
+// Returns: The index of the node.
+//
+//////////////////////////////////////////////////////////////////////////////
+int
+CRouteGraph::GetNode( int roadId, cvELnDir dir )
+{
+	return 2 * roadId + (dir == ePOS ? 0 : 1);
+} // end of GetNode
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: FindRoute
+// 	Finds a sequence of corridors that leads from one road to another.
+//
+// Remarks: The route always contains at least one corridor, even if the
+// 	source and destination nodes are the same; in that case the route
+// 	leaves the road and comes back to it.
+//
+// 	When looking for the shortest route, the function reads the route off
+// 	the cached shortest route tree of the destination, building the tree
+// 	if needed.  If that route has too many corridors, it performs an A*
+// 	search on the length of the roads and corridors, using the straight
+// 	line distance to the destination as the heuristic.  Otherwise, it
+// 	performs a breadth first search and returns the route that uses the
+// 	fewest corridors.
+//
+// Arguments:
+// 	srcRoad - identifier of the initial road
+// 	srcDir - direction of travel on the initial road
+// 	dstRoad - identifier of the destination road
+// 	dstDir - direction of travel on the destination road
+// 	shortest - true to minimize the length of the route, false to
+// 		minimize the number of corridors
+// 	maxSteps - maximum number of corridors in the route
+// 	route - (output) the corridors of the route, in order
+//
+// Returns: True if a route was found, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CRouteGraph::FindRoute(
+			int srcRoad,
+			cvELnDir srcDir,
+			int dstRoad,
+			cvELnDir dstDir,
+			bool shortest,
+			int maxSteps,
+			vector<TEdge>& route
+			) const
+{
+	route.clear();
+
+	int numNodes = (int)m_entryX.size();
+	int srcNode  = GetNode( srcRoad, srcDir );
+	int dstNode  = GetNode( dstRoad, dstDir );
+	if( srcRoad <= 0 || dstRoad <= 0 || srcNode >= numNodes ||
+		dstNode >= numNodes || maxSteps < 1 )
+	{
+		return false;
+	}
+
+	// the shortest route without a limit on the number of corridors is
+	// also the shortest one within the limit, as long as it respects it;
+	// the search limited by the number of corridors is only needed when
+	// that route is too long, and when there is no route at all there is
+	// none within the limit either
+	if( shortest )
+	{
+		if( !FindCachedRoute( srcNode, dstNode, route ) )  return false;
+		if( (int)route.size() <= maxSteps )  return true;
+		route.clear();
+	}
+
+	vector<int> edges;
+	bool found;
+	if( shortest )
+	{
+		found = FindShortestRoute( srcNode, dstNode, maxSteps, edges );
+	}
+	else
+	{
+		found = FindFewestStepsRoute( srcNode, dstNode, maxSteps, edges );
+	}
+
+	if( found )
+	{
+		vector<int>::const_reverse_iterator itr;
+		for( itr = edges.rbegin(); itr != edges.rend(); itr++ )
+		{
+			route.push_back( m_edges[*itr] );
+		}
+	}
+
+	return found;
+} // end of FindRoute
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: FindShortestRoute
+// 	Finds the shortest sequence of corridors that leads from one road to
+// 	another, regardless of the number of corridors.
+//
+// Remarks: When a route hierarchy is available, it is searched from both
+// 	ends of the route, following only edges that lead to more important
+// 	roads, and the shortcuts of the route are then expanded into the
+// 	corridors they bypass.  Otherwise, when the source and destination
+// 	nodes are the same, or when the shortest route tree of the destination
+// 	has already been built, the route is read off that tree.
+//
+// 	The hierarchy reflects the lane attributes in the LRI file; lanes
+// 	whose attributes are changed at run time are not taken into account.
+//
+// Arguments:
+// 	srcRoad - identifier of the initial road
+// 	srcDir - direction of travel on the initial road
+// 	dstRoad - identifier of the destination road
+// 	dstDir - direction of travel on the destination road
+// 	route - (output) the corridors of the route, in order
+//
+// Returns: True if a route was found, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CRouteGraph::FindShortestRoute(
+			int srcRoad,
+			cvELnDir srcDir,
+			int dstRoad,
+			cvELnDir dstDir,
+			vector<TEdge>& route
+			) const
+{
+	route.clear();
+
+	int numNodes = (int)m_entryX.size();
+	int srcNode  = GetNode( srcRoad, srcDir );
+	int dstNode  = GetNode( dstRoad, dstDir );
+	if( srcRoad <= 0 || dstRoad <= 0 || srcNode >= numNodes ||
+		dstNode >= numNodes )
+	{
+		return false;
+	}
+
+	if( HasHierarchy() && srcNode != dstNode && !HasRouteTree( dstNode ) )
+	{
+		return FindHierarchyRoute( srcNode, dstNode, route );
+	}
+
+	return FindCachedRoute( srcNode, dstNode, route );
+} // end of FindShortestRoute
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: FindShortestRoute (private)
+// 	Performs an A* search for the shortest route between two nodes that
+// 	uses at most maxSteps edges.
+//
+// Remarks: The search runs over labels made of a node and the number of
+// 	edges used to reach it, so that a node reached in a shorter way
+// 	through more edges does not hide a longer way through fewer edges,
+// 	which may be the only one that still fits within the limit.  A label
+// 	is not expanded when the same node has already been expanded with no
+// 	more edges and no greater length.  Labels are only created for the
+// 	pairs the search reaches, so the memory used does not grow with the
+// 	size of the graph times the limit.
+//
+// 	This search is only used when the shortest route without a limit
+// 	has too many edges, see FindRoute.
+//
+// 	The destination is represented by an extra node with index numNodes,
+// 	so that a route from a node back to itself can be found.  Labels are
+// 	not closed once expanded; a label is expanded again if a shorter way
+// 	to reach it is found, which keeps the result exact even where the
+// 	geometry makes the heuristic slightly inconsistent.
+//
+// Arguments:
+// 	srcNode - the initial node
+// 	dstNode - the destination node
+// 	maxSteps - maximum number of edges in the route
+// 	edges - (output) indexes of the edges of the route, last one first
+//
+// Returns: True if a route was found, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CRouteGraph::FindShortestRoute(
+			int srcNode,
+			int dstNode,
+			int maxSteps,
+			vector<int>& edges
+			) const
+{
+	typedef pair<double, int> TQueueItem;	// estimated length, label
+
+	struct TLabel {
+		int		node;
+		int		steps;		// edges used to reach the node
+		double	dist;		// length of the route to the node
+		int		prevEdge;	// last edge of that route
+		int		prev;		// label the edge leaves from
+	};
+
+	int goalNode = (int)m_entryX.size();
+
+	// the edges have positive lengths, so the shortest route visits each
+	// node at most once and never needs more edges than there are nodes
+	if( maxSteps > goalNode + 1 )  maxSteps = goalNode + 1;
+
+	// labels are found by node * ( maxSteps + 1 ) + steps
+	long long stride = maxSteps + 1;
+	vector<TLabel> labels;
+	unordered_map<long long, int> labelIdx;
+	unordered_map<int, pair<int, double> > done;	// fewest edges with
+													//	which each node was
+													//	expanded, and length
+	priority_queue<
+			TQueueItem,
+			vector<TQueueItem>,
+			greater<TQueueItem>
+			> open;
+
+	double dstX = m_entryX[dstNode];
+	double dstY = m_entryY[dstNode];
+
+	TLabel first = { srcNode, 0, 0.0, -1, -1 };
+	labels.push_back( first );
+	labelIdx[srcNode * stride] = 0;
+	open.push( TQueueItem( 0.0, 0 ) );
+
+	int goalLabel = -1;
+	while( !open.empty() )
+	{
+		TQueueItem item = open.top();
+		open.pop();
+
+		int label   = item.second;
+		int node    = labels[label].node;
+		int nSteps  = labels[label].steps;
+		double curDist = labels[label].dist;
+		if( node == goalNode )
+		{
+			goalLabel = label;
+			break;
+		}
+
+		double dx = m_entryX[node] - dstX;
+		double dy = m_entryY[node] - dstY;
+		if( item.first > curDist + sqrt( dx * dx + dy * dy ) )
+		{
+			// stale entry, the label was reached again in a shorter way
+			continue;
+		}
+
+		unordered_map<int, pair<int, double> >::iterator doneItr =
+				done.find( node );
+		if( doneItr != done.end() )
+		{
+			if( nSteps >= doneItr->second.first &&
+				curDist >= doneItr->second.second )
+			{
+				// the node was already expanded in a way that is as
+				// short and uses as few edges
+				continue;
+			}
+			if( nSteps < doneItr->second.first )
+			{
+				doneItr->second = make_pair( nSteps, curDist );
+			}
+		}
+		else
+		{
+			done[node] = make_pair( nSteps, curDist );
+		}
+		if( nSteps >= maxSteps )  continue;
+
+		for( int e = m_firstEdge[node]; e < m_firstEdge[node + 1]; e++ )
+		{
+			const TEdge& cEdge = m_edges[e];
+			int next = GetNode( cEdge.dstRoad, cEdge.dstDir );
+			double nextDist = curDist + cEdge.length;
+
+			if( next == dstNode )
+			{
+				next = goalNode;
+			}
+			else if( next == srcNode )
+			{
+				// coming back to the start is never shorter
+				continue;
+			}
+
+			long long key = next * stride + nSteps + 1;
+			unordered_map<long long, int>::iterator itr = labelIdx.find( key );
+			int nextLabel;
+			if( itr == labelIdx.end() )
+			{
+				nextLabel = (int)labels.size();
+				TLabel newLabel = { next, nSteps + 1, nextDist, e, label };
+				labels.push_back( newLabel );
+				labelIdx[key] = nextLabel;
+			}
+			else if( nextDist < labels[itr->second].dist )
+			{
+				nextLabel = itr->second;
+				labels[nextLabel].dist     = nextDist;
+				labels[nextLabel].prevEdge = e;
+				labels[nextLabel].prev     = label;
+			}
+			else
+			{
+				continue;
+			}
+
+			double h = 0.0;
+			if( next != goalNode )
+			{
+				dx = m_entryX[next] - dstX;
+				dy = m_entryY[next] - dstY;
+				h = sqrt( dx * dx + dy * dy );
+			}
+			open.push( TQueueItem( nextDist + h, nextLabel ) );
+		}
+	}
+
+	if( goalLabel < 0 )  return false;
+
+	edges.clear();
+	int label = goalLabel;
+	while( labels[label].prevEdge >= 0 )
+	{
+		edges.push_back( labels[label].prevEdge );
+		label = labels[label].prev;
+	}
+
+	return true;
+} // end of FindShortestRoute
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: FindFewestStepsRoute (private)
+// 	Performs a breadth first search for the route between two nodes that
+// 	uses the fewest edges.
+//
+// Remarks: Among the routes with the fewest edges, the one found first
+// 	when the corridors of each intersection are visited in order is
+// 	returned, which is the route the tree search used by earlier versions
+// 	of CPath::CalculateRoute returned.
+//
+// Arguments:
+// 	srcNode - the initial node
+// 	dstNode - the destination node
+// 	maxSteps - maximum number of edges in the route
+// 	edges - (output) indexes of the edges of the route, last one first
+//
+// Returns: True if a route was found, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CRouteGraph::FindFewestStepsRoute(
+			int srcNode,
+			int dstNode,
+			int maxSteps,
+			vector<int>& edges
+			) const
+{
+	int numNodes = (int)m_entryX.size();
+	vector<int> steps( numNodes, -1 );
+	vector<int> prevEdge( numNodes, -1 );
+	vector<int> queue;
+	int goalEdge = -1;
+
+	queue.reserve( numNodes );
+	queue.push_back( srcNode );
+	steps[srcNode] = 0;
+
+	for( size_t head = 0; head < queue.size() && goalEdge < 0; head++ )
+	{
+		int node = queue[head];
+		if( steps[node] >= maxSteps )  break;
+
+		for( int e = m_firstEdge[node]; e < m_firstEdge[node + 1]; e++ )
+		{
+			int next = GetNode( m_edges[e].dstRoad, m_edges[e].dstDir );
+
+			if( next == dstNode )
+			{
+				goalEdge = e;
+				break;
+			}
+			if( steps[next] < 0 )
+			{
+				steps[next] = steps[node] + 1;
+				prevEdge[next] = e;
+				queue.push_back( next );
+			}
+		}
+	}
+
+	if( goalEdge < 0 )  return false;
+
+	edges.clear();
+	int e = goalEdge;
+	while( e >= 0 )
+	{
+		edges.push_back( e );
+		e = prevEdge[GetNode( m_edges[e].srcRoad, m_edges[e].srcDir )];
+	}
+
+	return true;
+} // end of FindFewestStepsRoute
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: FindHierarchyRoute (private)
+// 	Searches the route hierarchy for the shortest route between two nodes.
+//
+// Remarks: A Dijkstra search over the upward edges starts at the source
+// 	and one over the downward edges, traversed backwards, starts at the
+// 	destination.  The two searches alternate and each one stops when the
+// 	nodes left to settle are farther than the best route found so far.
+// 	The route goes through the node at which the searches met; its edges
+// 	are then unpacked, replacing each shortcut by the two edges it
+// 	bypasses, until only corridors remain.
+//
+// Arguments:
+// 	srcNode - the initial node
+// 	dstNode - the destination node, different from srcNode
+// 	route - (output) the corridors of the route, in order
+//
+// Returns: True if a route was found, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CRouteGraph::FindHierarchyRoute(
+			int srcNode,
+			int dstNode,
+			vector<TEdge>& route
+			) const
+{
+	typedef pair<double, int> TQueueItem;	// length, node
+	typedef priority_queue<
+				TQueueItem,
+				vector<TQueueItem>,
+				greater<TQueueItem>
+				> TQueue;
+
+	const double cINFINITY = numeric_limits<double>::max();
+	int numNodes = m_numHierNodes - 1;
+
+	// index 0 is the forward search, index 1 the backward search
+	vector<double> dist[2];
+	vector<int> prevNode[2];
+	vector<int> prevEdge[2];
+	TQueue open[2];
+
+	for( int side = 0; side < 2; side++ )
+	{
+		dist[side].assign( numNodes, cINFINITY );
+		prevNode[side].assign( numNodes, -1 );
+		prevEdge[side].assign( numNodes, -1 );
+	}
+	dist[0][srcNode] = 0.0;
+	dist[1][dstNode] = 0.0;
+	open[0].push( TQueueItem( 0.0, srcNode ) );
+	open[1].push( TQueueItem( 0.0, dstNode ) );
+
+	double best = cINFINITY;
+	int meetNode = -1;
+
+	while( !open[0].empty() || !open[1].empty() )
+	{
+		for( int side = 0; side < 2; side++ )
+		{
+			if( open[side].empty() )  continue;
+
+			TQueueItem item = open[side].top();
+			if( item.first >= best )
+			{
+				// nothing left to settle can improve the route
+				open[side] = TQueue();
+				continue;
+			}
+			open[side].pop();
+
+			int node = item.second;
+			if( item.first > dist[side][node] )  continue;
+
+			if( dist[1 - side][node] < cINFINITY &&
+				dist[0][node] + dist[1][node] < best )
+			{
+				best = dist[0][node] + dist[1][node];
+				meetNode = node;
+			}
+
+			int first, last;
+			if( side == 0 )
+			{
+				first = m_pHierNodes[node].firstUpEdge;
+				last  = m_pHierNodes[node + 1].firstUpEdge;
+			}
+			else
+			{
+				first = m_pHierNodes[node].firstDownEdge;
+				last  = m_pHierNodes[node + 1].firstDownEdge;
+			}
+
+			for( int e = first; e < last; e++ )
+			{
+				int next = m_pHierEdges[e].node;
+				double nextDist = dist[side][node] + m_pHierEdges[e].length;
+
+				if( nextDist < dist[side][next] )
+				{
+					dist[side][next] = nextDist;
+					prevNode[side][next] = node;
+					prevEdge[side][next] = e;
+					open[side].push( TQueueItem( nextDist, next ) );
+				}
+			}
+		}
+	}
+
+	if( meetNode < 0 )  return false;
+
+	// the edges of the route in order, as (from, to, edge) triples
+	struct TPiece {
+		int from;
+		int to;
+		const cvTRouteHierEdge* pEdge;
+	};
+	vector<TPiece> pieces;
+
+	int node = meetNode;
+	while( node != srcNode )
+	{
+		TPiece piece = { prevNode[0][node], node, &m_pHierEdges[prevEdge[0][node]] };
+		pieces.push_back( piece );
+		node = prevNode[0][node];
+	}
+	reverse( pieces.begin(), pieces.end() );
+
+	node = meetNode;
+	while( node != dstNode )
+	{
+		TPiece piece = { node, prevNode[1][node], &m_pHierEdges[prevEdge[1][node]] };
+		pieces.push_back( piece );
+		node = prevNode[1][node];
+	}
+
+	// unpack the shortcuts; the stack holds the pieces left to unpack,
+	// the next one last
+	reverse( pieces.begin(), pieces.end() );
+	while( !pieces.empty() )
+	{
+		TPiece piece = pieces.back();
+		pieces.pop_back();
+
+		if( piece.pEdge->middle < 0 )
+		{
+			TEdge edge;
+			edge.srcRoad = piece.from / 2;
+			edge.srcDir  = (piece.from % 2 == 0) ? ePOS : eNEG;
+			edge.crdrId  = piece.pEdge->crdrId;
+			edge.dstRoad = piece.to / 2;
+			edge.dstDir  = (piece.to % 2 == 0) ? ePOS : eNEG;
+			edge.length  = piece.pEdge->length;
+			route.push_back( edge );
+			continue;
+		}
+
+		int middle = piece.pEdge->middle;
+		const cvTRouteHierEdge* pFirst  = FindHierarchyEdge( piece.from, middle );
+		const cvTRouteHierEdge* pSecond = FindHierarchyEdge( middle, piece.to );
+		if( pFirst == 0 || pSecond == 0 )
+		{
+			route.clear();
+			return false;
+		}
+
+		TPiece second = { middle, piece.to, pSecond };
+		TPiece first  = { piece.from, middle, pFirst };
+		pieces.push_back( second );
+		pieces.push_back( first );
+	}
+
+	return true;
+} // end of FindHierarchyRoute
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: FindHierarchyEdge (private)
+// 	Finds the edge of the route hierarchy between two nodes.
+//
+// Remarks: An edge is stored with the less important of its two nodes: as
+// 	an upward edge of its source, or as a downward edge of its target.
+//
+// Arguments:
+// 	from - the source node
+// 	to - the target node
+//
+// Returns: A pointer to the edge, or 0 if the nodes are not connected.
+//
+//////////////////////////////////////////////////////////////////////////////
+const cvTRouteHierEdge*
+CRouteGraph::FindHierarchyEdge( int from, int to ) const
+{
+	int first, last, other;
+	if( m_pHierNodes[from].rank < m_pHierNodes[to].rank )
+	{
+		first = m_pHierNodes[from].firstUpEdge;
+		last  = m_pHierNodes[from + 1].firstUpEdge;
+		other = to;
+	}
+	else
+	{
+		first = m_pHierNodes[to].firstDownEdge;
+		last  = m_pHierNodes[to + 1].firstDownEdge;
+		other = from;
+	}
+
+	for( int e = first; e < last; e++ )
+	{
+		if( m_pHierEdges[e].node == other )  return &m_pHierEdges[e];
+	}
+
+	return 0;
+} // end of FindHierarchyEdge
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: FindCachedRoute (private)
+// 	Reads the shortest route between two nodes off the shortest route
+// 	tree of the destination.
+//
+// Remarks: The first corridor is the one that minimizes its length plus
+// 	the length of the route from its target, which also covers routes
+// 	that leave the destination road and come back to it.  The rest of
+// 	the route follows the tree.
+//
+// Arguments:
+// 	srcNode - the initial node
+// 	dstNode - the destination node
+// 	route - (output) the corridors of the route, in order
+//
+// Returns: True if a route was found, false otherwise.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CRouteGraph::FindCachedRoute(
+			int srcNode,
+			int dstNode,
+			vector<TEdge>& route
+			) const
+{
+	const double cINFINITY = numeric_limits<double>::max();
+	TRouteTreePtr pTree = GetRouteTree( dstNode );
+	const TRouteTree& cTree = *pTree;
+
+	route.clear();
+
+	int firstEdge = -1;
+	double best = cINFINITY;
+	for( int e = m_firstEdge[srcNode]; e < m_firstEdge[srcNode + 1]; e++ )
+	{
+		int next = GetNode( m_edges[e].dstRoad, m_edges[e].dstDir );
+		if( cTree.dist[next] == cINFINITY )  continue;
+
+		double length = m_edges[e].length + cTree.dist[next];
+		if( length < best )
+		{
+			best = length;
+			firstEdge = e;
+		}
+	}
+
+	if( firstEdge < 0 )  return false;
+
+	int e = firstEdge;
+	while( true )
+	{
+		route.push_back( m_edges[e] );
+
+		int node = GetNode( m_edges[e].dstRoad, m_edges[e].dstDir );
+		if( node == dstNode )  break;
+		e = cTree.nextEdge[node];
+	}
+
+	return true;
+} // end of FindCachedRoute
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: HasRouteTree (private)
+// 	Indicates if the shortest route tree of a destination is in the cache.
+//
+// Remarks:
+//
+// Arguments:
+// 	dstNode - the destination node
+//
+// Returns: True if the tree has been built and not yet discarded.
+//
+//////////////////////////////////////////////////////////////////////////////
+bool
+CRouteGraph::HasRouteTree( int dstNode ) const
+{
+	lock_guard<mutex> guard( m_routeTreeLock );
+	return m_routeTrees.find( dstNode ) != m_routeTrees.end();
+} // end of HasRouteTree
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: GetRouteTree (private)
+// 	Returns the shortest route tree of a destination, building it if it
+// 	is not in the cache.
+//
+// Remarks: The tree is built by a Dijkstra search that starts at the
+// 	destination and follows the edges backwards.  The search runs without
+// 	holding the cache lock, so two threads may build the same tree; the
+// 	one stored first is kept.  When the cache is full, the oldest tree is
+// 	discarded.
+//
+// Arguments:
+// 	dstNode - the destination node
+//
+// Returns: The tree, which remains valid as long as the caller holds it.
+//
+//////////////////////////////////////////////////////////////////////////////
+CRouteGraph::TRouteTreePtr
+CRouteGraph::GetRouteTree( int dstNode ) const
+{
+	{
+		lock_guard<mutex> guard( m_routeTreeLock );
+		unordered_map<int, TRouteTreePtr>::const_iterator itr =
+				m_routeTrees.find( dstNode );
+		if( itr != m_routeTrees.end() )  return itr->second;
+	}
+
+	typedef pair<double, int> TQueueItem;	// length, node
+
+	const double cINFINITY = numeric_limits<double>::max();
+	int numNodes = (int)m_entryX.size();
+	shared_ptr<TRouteTree> pTree = make_shared<TRouteTree>();
+	TRouteTree& tree = *pTree;
+
+	tree.dist.assign( numNodes, cINFINITY );
+	tree.nextEdge.assign( numNodes, -1 );
+	priority_queue<
+			TQueueItem,
+			vector<TQueueItem>,
+			greater<TQueueItem>
+			> open;
+
+	tree.dist[dstNode] = 0.0;
+	open.push( TQueueItem( 0.0, dstNode ) );
+
+	while( !open.empty() )
+	{
+		TQueueItem item = open.top();
+		open.pop();
+
+		int node = item.second;
+		if( item.first > tree.dist[node] )  continue;
+
+		for( int i = m_firstInEdge[node]; i < m_firstInEdge[node + 1]; i++ )
+		{
+			int e = m_inEdges[i];
+			int prev = GetNode( m_edges[e].srcRoad, m_edges[e].srcDir );
+			double prevDist = tree.dist[node] + m_edges[e].length;
+
+			if( prevDist < tree.dist[prev] )
+			{
+				tree.dist[prev] = prevDist;
+				tree.nextEdge[prev] = e;
+				open.push( TQueueItem( prevDist, prev ) );
+			}
+		}
+	}
+
+	lock_guard<mutex> guard( m_routeTreeLock );
+	TRouteTreePtr& cached = m_routeTrees[dstNode];
+	if( cached )  return cached;
+
+	cached = pTree;
+	TRouteTreePtr result = cached;
+	m_routeTreeOrder.push_back( dstNode );
+	if( (int)m_routeTreeOrder.size() > cMAX_ROUTE_TREES )
+	{
+		m_routeTrees.erase( m_routeTreeOrder.front() );
+		m_routeTreeOrder.pop_front();
+	}
+
+	return result;
+} // end of GetRouteTree
+
+} // namespace CVED
@@ -29,6 +29,108 @@ static CRandNumGen         gRandNumGen(24, 42);
 
 const double cGRAVITY = 9.80665;      // meters/sec^2
 
+const unsigned int cSOL_CACHE_MAGIC   = 0x42534F4C; // "LOSB"
+const unsigned int cSOL_CACHE_VERSION = 1;
+const char         cSOL_CACHE_FILE[]  = "sol2.bin";
+
+//
+// Helpers used to read and write the binary SOL cache
+//
+template <class T>
+static void BinWrite(ostream& out, const T& val)
+{
+	out.write((const char*) &val, sizeof(T));
+}
+
+static void BinWrite(ostream& out, const string& str)
+{
+	int size = (int) str.size();
+	BinWrite(out, size);
+	out.write(str.data(), size);
+}
+
+template <class T>
+static void BinRead(istream& in, T& val)
+{
+	in.read((char*) &val, sizeof(T));
+}
+
+static void BinRead(istream& in, string& str)
+{
+	int size = 0;
+	BinRead(in, size);
+	if (in.fail() || size < 0) {
+		in.setstate(ios::failbit);
+		return;
+	}
+	str.resize(size);
+	if (size > 0)
+		in.read(&str[0], size);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: ChecksumFile
+//   Accumulates the contents of a file into a checksum.
+//
+// Remarks: The checksum is a 32 bit FNV-1a hash.  The name of the file
+//   is included so renaming an auxiliary sol file changes the checksum.
+//
+// Arguments:
+//   fileName - the file to read
+//   checksum - (in/out) the checksum to update
+//
+// Returns: false if the file could not be read, true otherwise
+//
+//////////////////////////////////////////////////////////////////////////////
+static bool ChecksumFile(const string& fileName, unsigned int& checksum)
+{
+	ifstream in(fileName.c_str(), ios::binary);
+	if (!in)
+		return false;
+
+	for (string::const_iterator c = fileName.begin(); c != fileName.end(); c++) {
+		checksum ^= (unsigned char) *c;
+		checksum *= 16777619u;
+	}
+
+	char buffer[65536];
+	while (in.read(buffer, sizeof(buffer)) || in.gcount() > 0) {
+		streamsize count = in.gcount();
+		for (streamsize i = 0; i < count; i++) {
+			checksum ^= (unsigned char) buffer[i];
+			checksum *= 16777619u;
+		}
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: CreateSolObj
+//   Creates an empty object of the specified sol category.
+//
+// Arguments:
+//   objType - the category name, as it appears in the sol2 file
+//
+// Returns: the new object, or NULL if the category is not valid
+//
+//////////////////////////////////////////////////////////////////////////////
+static CSolObj* CreateSolObj(const string& objType)
+{
+	if (objType == "Vehicle")       return new CSolObjVehicle((int) -1);
+	if (objType == "TrafLight")     return new CSolObjTrafLight((int) -1);
+	if (objType == "Obstacle")      return new CSolObjObstacle((int) -1);
+	if (objType == "TrafSign")      return new CSolObjTrafSign((int) -1);
+	if (objType == "Terrain")       return new CSolObjTerrain((int) -1);
+	if (objType == "Poi")           return new CSolObjPoi((int) -1);
+	if (objType == "Walker")        return new CSolObjWalker((int) -1);
+	if (objType == "DiGuy")         return new CSolObjDiGuy((int) -1);
+	if (objType == "SpecialEffect") return new CSolObjSpecialEffect((int) -1);
+	if (objType == "Composite")     return new CSolObjComposite((int) -1);
+	return NULL;
+}
+
 bool CSol::Init(bool ForceAfterFail)
 {
 	string data;
@@ -56,20 +158,13 @@ bool CSol::Init(bool ForceAfterFail)
 	 m_parseLog = m_lastError;
 	 return false;
 	}
-	if (!ParseFile(soltxt)){
-		m_failed = true;
-		m_hasParseError = true;
-		m_parseLog = m_lastError;
-		return false;
-	}
-	soltxt.close();
-	soltxt.clear();
     WIN32_FIND_DATA FindFileData;
     HANDLE hFind = INVALID_HANDLE_VALUE;
     //char DirSpec[MAX_PATH + 1];  // directory specification
     DWORD dwError;
     string dir = envVar;
     dir +="*.txt";
+    vector<string> auxFileNames;
     hFind = FindFirstFile(dir.c_str(), &FindFileData);
     
     while (FindNextFile(hFind, &FindFileData) != 0) 
@@ -80,31 +175,66 @@ bool CSol::Init(bool ForceAfterFail)
 	 	   tempFileName.substr(0,8) == "sol2_aux" &&
 	 	   tempFileName != "sol2.txt"){
 	 		   tempFileName.insert(0,envVar);
-	 		   soltxt.open(tempFileName.c_str());
+	 		   auxFileNames.push_back(tempFileName);
+	    }
+     }
+    dwError = ::GetLastError();
+    FindClose(hFind);
+
+	//
+	// The binary cache is only usable if none of the sol2 files changed
+	// since it was written.
+	//
+	unsigned int checksum = 2166136261u;
+	ChecksumFile(fileName, checksum);
+	for (vector<string>::const_iterator i = auxFileNames.begin(); i != auxFileNames.end(); i++)
+		ChecksumFile(*i, checksum);
+	char checksumStr[16];
+	sprintf_s(checksumStr, sizeof(checksumStr), "%08x", checksum);
+	m_checksum = checksumStr;
+
+	string cacheFileName = envVar + cSOL_CACHE_FILE;
+	if (LoadCache(cacheFileName)) {
+		m_init = true;
+		return true;
+	}
+
+	if (!ParseFile(soltxt)){
+		m_failed = true;
+		m_hasParseError = true;
+		m_parseLog = m_lastError;
+		return false;
+	}
+	soltxt.close();
+	soltxt.clear();
+    for (vector<string>::const_iterator i = auxFileNames.begin(); i != auxFileNames.end(); i++)
+    {
+	 		   soltxt.open(i->c_str());
 	 		   if (soltxt.is_open()){
 	 			 if (!ParseFile(soltxt)){
-	 				 errors_stream<<"Error in File" <<tempFileName<<":"<<endl
+	 				 errors_stream<<"Error in File" <<*i<<":"<<endl
 	 					 <<this->GetLastError()<<endl;
 					 m_hasParseError = true;
 	 			 }
 	 		   }
 	 		   soltxt.close();
 	 		   soltxt.clear();
-	    }
      }
     if (errors_stream.str().size() > 0){
 	    ofstream error_file("sol_aux_errors.txt");
 	    error_file<<errors_stream.str();
 	    error_file.close();
     }
-    dwError = ::GetLastError();
-    FindClose(hFind);
     if (dwError != ERROR_NO_MORE_FILES) 
     {
     
     }
     m_parseLog += errors_stream.str();
     
+    // only a clean parse is worth caching, otherwise the errors
+    // would not be reported by the next process
+    if (!m_hasParseError)
+		SaveCache(cacheFileName);
     
 	m_init = true;
 	return true;
@@ -121,38 +251,8 @@ bool  CSol::ParseFile(ifstream& soltxt){
 			// parse the headers
 			continue;
 		}
-		CSolObj* pObj;
-		if (objType == "Vehicle") {
-			pObj = new CSolObjVehicle((int) -1);
-		}
-		else if (objType == "TrafLight") {
-			pObj = new CSolObjTrafLight((int) -1);
-		}
-		else if (objType == "Obstacle") {
- 			pObj = new CSolObjObstacle((int) -1);
-		}
-		else if (objType == "TrafSign") {
-			pObj = new CSolObjTrafSign((int) -1);
-		}
-		else if (objType == "Terrain") {
-			pObj = new CSolObjTerrain((int) -1);
-		}
-		else if (objType == "Poi") {
-			pObj = new CSolObjPoi((int) -1);
-		}
-		else if (objType == "Walker") {
-			pObj = new CSolObjWalker((int) -1);
-		}
-    	else if (objType == "DiGuy") {
-			pObj = new CSolObjDiGuy((int) -1);
-		}
-		else if (objType == "SpecialEffect") {
-			pObj = new CSolObjSpecialEffect((int) -1);
-		}
-		else if (objType == "Composite") {
-			pObj = new CSolObjComposite((int) -1);
-		}
-		else {
+		CSolObj* pObj = CreateSolObj(objType);
+		if (pObj == NULL) {
 			m_lastError = "Invalid object type (";
 			m_lastError += objType;
 			m_lastError += ")";
@@ -171,7 +271,7 @@ bool  CSol::ParseFile(ifstream& soltxt){
 			return false;
 		}
 		else {
-			if (m_nameToId.find(pObj->GetName())!=m_nameToId.end()){
+			if (m_nameToObj.find(pObj->GetName())!=m_nameToObj.end()){
 				string error;
 				error = "Object Must Have Unique NAME  type";
 				error += objType;
@@ -194,16 +294,131 @@ bool  CSol::ParseFile(ifstream& soltxt){
 				delete pObj;
 				return false;
 			}
-			m_nameToId[pObj->GetName()] = (int) pObj->GetId(); // this is before inserting into the m_objs vector
-			m_objs[pObj->GetId()] = (pObj);
-			m_typeToElements[objType].push_back(pObj->GetId());
-			m_objCnt++;
+			AddObj(pObj, objType);
 		}
 
 	}
 	return true;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: AddObj
+//   Adds a parsed object to the lookup tables.
+//
+// Arguments:
+//   pObj    - the object; the CSol takes ownership of it
+//   objType - the category name of the object
+//
+//////////////////////////////////////////////////////////////////////////////
+void CSol::AddObj(CSolObj* pObj, const string& objType)
+{
+	m_nameToObj[pObj->GetName()] = pObj;
+	m_objs[pObj->GetId()] = (pObj);
+	m_typeToElements[objType].push_back(pObj->GetId());
+	m_objCnt++;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: LoadCache
+//   Loads the objects from the binary sol cache.
+//
+// Remarks: The cache is rejected if it was written by a different version
+//   of this code or for sol2 files with a different checksum.  Nothing is
+//   added to the tables unless the whole cache can be read.
+//
+// Arguments:
+//   fileName - the name of the cache file
+//
+// Returns: true if the objects were loaded from the cache
+//
+//////////////////////////////////////////////////////////////////////////////
+bool CSol::LoadCache(const string& fileName)
+{
+	ifstream in(fileName.c_str(), ios::binary);
+	if (!in)
+		return false;
+
+	unsigned int magic = 0;
+	unsigned int version = 0;
+	string checksum;
+	int count = 0;
+	BinRead(in, magic);
+	BinRead(in, version);
+	BinRead(in, checksum);
+	BinRead(in, count);
+	if (in.fail() || magic != cSOL_CACHE_MAGIC ||
+			version != cSOL_CACHE_VERSION || checksum != m_checksum) {
+		return false;
+	}
+
+	vector<pair<string, CSolObj*> > objs;
+	for (int i = 0; i < count; i++) {
+		string objType;
+		BinRead(in, objType);
+		CSolObj* pObj = in.fail() ? NULL : CreateSolObj(objType);
+		if (pObj == NULL || !pObj->Load(in)) {
+			delete pObj;
+			for (vector<pair<string, CSolObj*> >::iterator j = objs.begin(); j != objs.end(); j++)
+				delete j->second;
+			return false;
+		}
+		objs.push_back(make_pair(objType, pObj));
+	}
+
+	for (vector<pair<string, CSolObj*> >::iterator j = objs.begin(); j != objs.end(); j++)
+		AddObj(j->second, j->first);
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Description: SaveCache
+//   Writes the objects to the binary sol cache.
+//
+// Remarks: The objects of each category are written in the order they
+//   were parsed, so m_typeToElements, which PickRandomSolObjectFromCategory
+//   indexes into, is rebuilt identically by LoadCache.  The file is written
+//   under a temporary name first so a process reading the cache never sees
+//   a partially written file.  Failure to write the cache is not an error.
+//
+// Arguments:
+//   fileName - the name of the cache file
+//
+//////////////////////////////////////////////////////////////////////////////
+void CSol::SaveCache(const string& fileName) const
+{
+	stringstream tempName;
+	tempName << fileName << "." << ::GetCurrentProcessId();
+
+	ofstream out(tempName.str().c_str(), ios::binary);
+	if (!out)
+		return;
+
+	BinWrite(out, cSOL_CACHE_MAGIC);
+	BinWrite(out, cSOL_CACHE_VERSION);
+	BinWrite(out, m_checksum);
+	BinWrite(out, m_objCnt);
+	map<string, vector<int> >::const_iterator type;
+	for (type = m_typeToElements.begin(); type != m_typeToElements.end(); type++) {
+		vector<int>::const_iterator id;
+		for (id = type->second.begin(); id != type->second.end(); id++) {
+			BinWrite(out, type->first);
+			m_objs.find(*id)->second->Save(out);
+		}
+	}
+	out.close();
+
+	if (out.fail()) {
+		remove(tempName.str().c_str());
+		return;
+	}
+	remove(fileName.c_str());
+	if (rename(tempName.str().c_str(), fileName.c_str()) != 0)
+		remove(tempName.str().c_str());
+}
+
 
 bool CSol::ParseHeader(ifstream& in)
 {
@@ -910,6 +1125,78 @@ bool CSolObj::Parse(ifstream& in)
 	return true;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CSolObj::Save(ostream& out) const
+{
+	BinWrite(out, m_id);
+	BinWrite(out, m_length);
+	BinWrite(out, m_width);
+	BinWrite(out, m_height);
+	BinWrite(out, m_isatBbox);
+	BinWrite(out, m_visModelName);
+	BinWrite(out, m_visModelCigiId);
+	BinWrite(out, m_canBe);
+	BinWrite(out, m_isatBitmap);
+	BinWrite(out, m_isatModelLow);
+	BinWrite(out, m_isatModelHigh);
+	BinWrite(out, m_frictionCoeff);
+	BinWrite(out, m_bounceEnergyLoss);
+	BinWrite(out, m_SirenSoundID);
+	BinWrite(out, m_SirenSoundIntensity);
+	BinWrite(out, (int) m_options.size());
+	for (vector<CSolOption>::const_iterator i = m_options.begin(); i != m_options.end(); i++) {
+		BinWrite(out, i->switchChild);
+		BinWrite(out, i->name);
+		BinWrite(out, i->bitmap);
+		BinWrite(out, i->modelLow);
+		BinWrite(out, i->modelHigh);
+	}
+	BinWrite(out, m_name);
+	BinWrite(out, m_friendlyName);
+	BinWrite(out, m_DefaultSoundID);
+	BinWrite(out, m_DefaultSoundIntesity);
+	BinWrite(out, m_CollisionSoundID);
+	BinWrite(out, m_CollisionSoundIntensity);
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CSolObj::Load(istream& in)
+{
+	BinRead(in, m_id);
+	BinRead(in, m_length);
+	BinRead(in, m_width);
+	BinRead(in, m_height);
+	BinRead(in, m_isatBbox);
+	BinRead(in, m_visModelName);
+	BinRead(in, m_visModelCigiId);
+	BinRead(in, m_canBe);
+	BinRead(in, m_isatBitmap);
+	BinRead(in, m_isatModelLow);
+	BinRead(in, m_isatModelHigh);
+	BinRead(in, m_frictionCoeff);
+	BinRead(in, m_bounceEnergyLoss);
+	BinRead(in, m_SirenSoundID);
+	BinRead(in, m_SirenSoundIntensity);
+	int numOptions = 0;
+	BinRead(in, numOptions);
+	for (int i = 0; i < numOptions && !in.fail(); i++) {
+		CSolOption option;
+		BinRead(in, option.switchChild);
+		BinRead(in, option.name);
+		BinRead(in, option.bitmap);
+		BinRead(in, option.modelLow);
+		BinRead(in, option.modelHigh);
+		m_options.push_back(option);
+	}
+	BinRead(in, m_name);
+	BinRead(in, m_friendlyName);
+	BinRead(in, m_DefaultSoundID);
+	BinRead(in, m_DefaultSoundIntesity);
+	BinRead(in, m_CollisionSoundID);
+	BinRead(in, m_CollisionSoundIntensity);
+	return !in.fail();
+}
+
 
 const string& CSol::GetChecksum() const
 {
@@ -919,14 +1206,9 @@ const string& CSol::GetChecksum() const
 
 const CSolObj* CSol::GetObj(const string& name) const
 {
-	map<string, int>::const_iterator i = m_nameToId.find(name);
-	if (i == m_nameToId.end()) return NULL;
-	else{
-		int index = i->second;
-		map<int,CSolObj*>::const_iterator iPobj =  m_objs.find(index);
-		if (iPobj == m_objs.end()) return NULL;
-		return iPobj->second;
-	}
+	unordered_map<string, CSolObj*>::const_iterator i = m_nameToObj.find(name);
+	if (i == m_nameToObj.end()) return NULL;
+	return i->second;
 }
 
 
@@ -1126,6 +1408,7 @@ bool CSolObjVehicle::ParseDynaParams(ifstream& in) {
 	string str;
 	if (ParseUntilEnd(in, str)) {
 		m_dynaParams = CDynaParams(str);
+		m_dynaParamsText = str;
 	} 
 	else {
 		return false;
@@ -1133,6 +1416,198 @@ bool CSolObjVehicle::ParseDynaParams(ifstream& in) {
 	return true;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CSolObjVehicle::Save(ostream& out) const
+{
+	CSolObj::Save(out);
+	BinWrite(out, m_type);
+	BinWrite(out, (int) m_colors.size());
+	for (vector<CSolColor>::const_iterator i = m_colors.begin(); i != m_colors.end(); i++) {
+		BinWrite(out, i->cigi);
+		BinWrite(out, i->r);
+		BinWrite(out, i->g);
+		BinWrite(out, i->b);
+	}
+	BinWrite(out, (int) m_axles.size());
+	for (vector<pair<int,float> >::const_iterator i = m_axles.begin(); i != m_axles.end(); i++) {
+		BinWrite(out, i->first);
+		BinWrite(out, i->second);
+	}
+	BinWrite(out, (int) m_specialOptions.size());
+	for (vector<CSpecialOption>::const_iterator i = m_specialOptions.begin(); i != m_specialOptions.end(); i++) {
+		BinWrite(out, i->name);
+		BinWrite(out, i->desc);
+		BinWrite(out, (int) i->m_switchOptions.size());
+		for (map<int,string>::const_iterator j = i->m_switchOptions.begin(); j != i->m_switchOptions.end(); j++) {
+			BinWrite(out, j->first);
+			BinWrite(out, j->second);
+		}
+	}
+	BinWrite(out, m_dynaParamsText);
+	BinWrite(out, m_hornSoundId);
+	BinWrite(out, m_hornSoundIntensity);
+	BinWrite(out, m_collisionVehSoundIntensity);
+	BinWrite(out, m_passingVehSoundId);
+	BinWrite(out, m_passingVehSoundIntensity);
+	BinWrite(out, m_eyepointOffset.m_x);
+	BinWrite(out, m_eyepointOffset.m_y);
+	BinWrite(out, m_eyepointOffset.m_z);
+	BinWrite(out, m_CollisionSoundID);
+	BinWrite(out, m_VehBrakesSoundID);
+	BinWrite(out, m_VehBrakesSoundIntensity);
+	BinWrite(out, m_VehMufflerSoundID);
+	BinWrite(out, m_VehMufflerSoundIntensity);
+	BinWrite(out, m_WheelVolIntensity);
+	BinWrite(out, m_isCabType);
+	BinWrite(out, m_lateralAccelLimitInMs2);
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CSolObjVehicle::Load(istream& in)
+{
+	if (!CSolObj::Load(in))
+		return false;
+	BinRead(in, m_type);
+	int count = 0;
+	BinRead(in, count);
+	m_colors.clear();
+	for (int i = 0; i < count && !in.fail(); i++) {
+		CSolColor color;
+		BinRead(in, color.cigi);
+		BinRead(in, color.r);
+		BinRead(in, color.g);
+		BinRead(in, color.b);
+		m_colors.push_back(color);
+	}
+	count = 0;
+	BinRead(in, count);
+	for (int i = 0; i < count && !in.fail(); i++) {
+		pair<int,float> axle;
+		BinRead(in, axle.first);
+		BinRead(in, axle.second);
+		m_axles.push_back(axle);
+	}
+	count = 0;
+	BinRead(in, count);
+	for (int i = 0; i < count && !in.fail(); i++) {
+		CSpecialOption option;
+		int numSwitch = 0;
+		BinRead(in, option.name);
+		BinRead(in, option.desc);
+		BinRead(in, numSwitch);
+		for (int j = 0; j < numSwitch && !in.fail(); j++) {
+			int num;
+			BinRead(in, num);
+			BinRead(in, option.m_switchOptions[num]);
+		}
+		m_specialOptions.push_back(option);
+	}
+	BinRead(in, m_dynaParamsText);
+	if (!m_dynaParamsText.empty())
+		m_dynaParams = CDynaParams(m_dynaParamsText);
+	BinRead(in, m_hornSoundId);
+	BinRead(in, m_hornSoundIntensity);
+	BinRead(in, m_collisionVehSoundIntensity);
+	BinRead(in, m_passingVehSoundId);
+	BinRead(in, m_passingVehSoundIntensity);
+	BinRead(in, m_eyepointOffset.m_x);
+	BinRead(in, m_eyepointOffset.m_y);
+	BinRead(in, m_eyepointOffset.m_z);
+	BinRead(in, m_CollisionSoundID);
+	BinRead(in, m_VehBrakesSoundID);
+	BinRead(in, m_VehBrakesSoundIntensity);
+	BinRead(in, m_VehMufflerSoundID);
+	BinRead(in, m_VehMufflerSoundIntensity);
+	BinRead(in, m_WheelVolIntensity);
+	BinRead(in, m_isCabType);
+	BinRead(in, m_lateralAccelLimitInMs2);
+	return !in.fail();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSolObjComposite::Save(ostream& out) const
+{
+	CSolObj::Save(out);
+	BinWrite(out, (int) m_references.size());
+	for (vector<CCompositeComponent>::const_iterator i = m_references.begin(); i != m_references.end(); i++) {
+		BinWrite(out, i->group);
+		BinWrite(out, i->childNum);
+		BinWrite(out, i->solRef);
+		BinWrite(out, i->x);
+		BinWrite(out, i->y);
+		BinWrite(out, i->width);
+		BinWrite(out, i->height);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CSolObjComposite::Load(istream& in)
+{
+	if (!CSolObj::Load(in))
+		return false;
+	int count = 0;
+	BinRead(in, count);
+	for (int i = 0; i < count && !in.fail(); i++) {
+		CCompositeComponent comp;
+		BinRead(in, comp.group);
+		BinRead(in, comp.childNum);
+		BinRead(in, comp.solRef);
+		BinRead(in, comp.x);
+		BinRead(in, comp.y);
+		BinRead(in, comp.width);
+		BinRead(in, comp.height);
+		m_references.push_back(comp);
+	}
+	return !in.fail();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSolObjWalker::Save(ostream& out) const
+{
+	CSolObj::Save(out);
+	BinWrite(out, m_animationSpeed);
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CSolObjWalker::Load(istream& in)
+{
+	if (!CSolObj::Load(in))
+		return false;
+	BinRead(in, m_animationSpeed);
+	return !in.fail();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// The terrain grid itself is not cached; it is rebuilt from the inline
+// map text or re-read from the map file, so edits to a map file are
+// picked up even though they do not change the sol checksum.
+void CSolObjTerrain::Save(ostream& out) const
+{
+	CSolObj::Save(out);
+	BinWrite(out, m_elevIsDelta);
+	BinWrite(out, m_surfaceObjectSoundId);
+	BinWrite(out, m_mapText);
+	BinWrite(out, m_mapFileName);
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CSolObjTerrain::Load(istream& in)
+{
+	if (!CSolObj::Load(in))
+		return false;
+	BinRead(in, m_elevIsDelta);
+	BinRead(in, m_surfaceObjectSoundId);
+	BinRead(in, m_mapText);
+	BinRead(in, m_mapFileName);
+	if (in.fail())
+		return false;
+	if (!m_mapText.empty())
+		m_map = CTerrainGrid<Post>(m_mapText);
+	if (!m_mapFileName.empty())
+		return LoadMapFile(m_mapFileName);
+	return true;
+}
+
 bool CSolObjComposite::Parse(ifstream& in)
 {
 	string dummy, str;
@@ -1248,6 +1723,7 @@ bool CSolObjTerrain::ParseMap(ifstream& in) {
 	if (ParseUntilEnd(in, str)) {
 		str.erase(str.find("&end&"));
 		m_map = CTerrainGrid<Post>(str);
+		m_mapText = str;
 	} 
 	else {
 		return false;
@@ -1256,6 +1732,13 @@ bool CSolObjTerrain::ParseMap(ifstream& in) {
 }
 
 bool CSolObjTerrain::ParseMapFile(ifstream& in) {
+    string fileName;
+	in>>fileName;
+	m_mapFileName = fileName;
+	return LoadMapFile(fileName);
+}
+
+bool CSolObjTerrain::LoadMapFile(const string& fileName) {
 	string token;
     stringstream lineparser;
     int numrows;
@@ -1266,8 +1749,6 @@ bool CSolObjTerrain::ParseMapFile(ifstream& in) {
     CBoundingBox box;
     vector<Post> data;
 
-    string fileName;
-	in>>fileName;
     string fullFileName;
     int lineCnt = 0;
     string EnvVar;
@@ -30,8 +30,12 @@ using namespace CVED;
 #define NUM_TIRES 4
 #define NUM_INPUTS 7
 
-cvTFourWheelVeh	g_stateVector[cNUM_DYN_OBJS];
-cvTVehLin		g_vehLin[cNUM_DYN_OBJS];
+//
+// Per dynamic object state of the vehicle dynamics, indexed by the
+// object identifier and sized by CCved::Configure.
+//
+vector<cvTFourWheelVeh>	g_stateVector;
+vector<cvTVehLin>		g_vehLin;
 
 //
 // Define a structure to hold vehicle information.
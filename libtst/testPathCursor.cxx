@@ -0,0 +1,209 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version: 		$Id: testPathCursor.cxx,v 1.1 $
+//
+// Author(s):
+// Date:
+//
+// Description:	Test of CPathCursor.  Random paths are built on the roads
+// of a database and traveled in small steps, both with a cursor and with
+// the CPath functions that take a CRoadPos, and the results are compared.
+// The paths are also modified after a cursor is placed, so that the
+// cursor has to be found on the path again.  The program exits with a
+// non zero status if any result differs.
+//
+// Usage: testPathCursor [lri file] [number of paths]
+//
+/////////////////////////////////////////////////////////////////////////////
+#ifdef _WIN32
+#include <iostream>
+#elif __sgi
+#include <iostream.h>
+#endif
+
+#include <cved.h>
+#include <cvedpub.h>
+
+using namespace CVED;
+using namespace std;
+
+static int s_failures = 0;
+static int s_checks   = 0;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// This function compares the result of a cursor travel with the result
+// of the corresponding CRoadPos travel, and reports any difference.
+//
+static void
+Compare(
+			const char* pWhat,
+			CPath::ETravelCode expCode,
+			const CRoadPos& cExpPos,
+			CPath::ETravelCode code,
+			const CPathCursor& cCursor
+			)
+{
+	s_checks++;
+
+	bool ok = ( code == expCode );
+	if ( ok && code == CPath::eCV_TRAVEL_OK ) {
+		ok = cCursor.IsValid() &&
+			cCursor.GetRoadPos().GetString() == cExpPos.GetString();
+	}
+
+	if ( !ok ) {
+		s_failures++;
+		cout << pWhat << ": expected " << expCode << " "
+			<< cExpPos.GetString() << ", got " << code << " "
+			<< ( cCursor.IsValid() ? cCursor.GetRoadPos().GetString() : "-" )
+			<< endl;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// This function travels along a path from the given position, first
+// forward until the end of the path and then backwards, with a cursor
+// and with GetRoadPos and TravelBack.
+//
+static void
+TestTravel(CPath& path, const CRoadPos& cStart, double step)
+{
+	CPathCursor cursor;
+	if ( !path.SetCursor(cStart, cursor) ) {
+		s_failures++;
+		cout << "SetCursor failed at " << cStart.GetString() << endl;
+		return;
+	}
+
+	CRoadPos pos = cStart;
+	int i;
+	for (i = 0; i < 1000; i++) {
+		CRoadPos next = pos;
+		CPath::ETravelCode expCode = path.GetRoadPos(step, pos, next);
+		CPath::ETravelCode code = path.Travel(step, cursor);
+
+		Compare("Travel", expCode, next, code, cursor);
+		if ( expCode != CPath::eCV_TRAVEL_OK || code != expCode ) break;
+		pos = next;
+	}
+
+	for (i = 0; i < 1000; i++) {
+		CRoadPos prev = pos;
+		CPath::ETravelCode expCode = path.TravelBack(step, pos, prev);
+		CPath::ETravelCode code = path.TravelBack(step, cursor);
+
+		Compare("TravelBack", expCode, prev, code, cursor);
+		if ( expCode != CPath::eCV_TRAVEL_OK || code != expCode ) break;
+		pos = prev;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// This function places a cursor in the middle of a path, modifies the
+// path so that the path point of the cursor changes, and checks that
+// the cursor still travels like a CRoadPos.
+//
+static void
+TestModifiedPath(CPath& path)
+{
+	CRoadPos start = path.GetStart();
+	CRoadPos mid = start;
+	if ( path.GetRoadPos(path.GetLength() / 2.0, start, mid) !=
+			CPath::eCV_TRAVEL_OK ) {
+		return;
+	}
+
+	CPathCursor cursor;
+	if ( !path.SetCursor(mid, cursor) ) {
+		s_failures++;
+		cout << "SetCursor failed at " << mid.GetString() << endl;
+		return;
+	}
+
+	// prepending moves every path point, so the cursor's path point no
+	// longer contains its position
+	if ( path.Prepend(200.0) ) {
+		CRoadPos next = mid;
+		CPath::ETravelCode expCode = path.GetRoadPos(20.0, mid, next);
+		CPath::ETravelCode code = path.Travel(20.0, cursor);
+		Compare("Travel after Prepend", expCode, next, code, cursor);
+		mid = cursor.GetRoadPos();
+	}
+
+	// removing the first path point moves them back
+	path.PopFront();
+	{
+		CRoadPos prev = mid;
+		CPath::ETravelCode expCode = path.TravelBack(20.0, mid, prev);
+		CPath::ETravelCode code = path.TravelBack(20.0, cursor);
+		Compare("TravelBack after PopFront", expCode, prev, code, cursor);
+		mid = cursor.GetRoadPos();
+	}
+
+	// once the part of the path holding the cursor is removed, the
+	// cursor cannot be found
+	while ( path.Size() > 1 && path.Contains(mid) ) {
+		path.PopBack();
+	}
+	if ( !path.Contains(mid) ) {
+		CPath::ETravelCode code = path.Travel(20.0, cursor);
+		s_checks++;
+		if ( code != CPath::eCV_TRAVEL_NOT_FOUND ) {
+			s_failures++;
+			cout << "Travel off the path returned " << code << endl;
+		}
+	}
+}
+
+
+int
+main(int argc, char **argv)
+{
+	string  lri   = argc > 1 ? argv[1] : "smallb.lri";
+	int     count = argc > 2 ? atoi(argv[2]) : 200;
+	CCved   cved;
+	string  msg;
+
+	if (!cved.Configure(CCved::eCV_SINGLE_USER, 0.1f, 2))
+	{
+		cout << "cved::configure failed: " << __LINE__ << endl;
+		exit(1);
+	}
+
+	if ( cved.Init(lri, msg) == false ) {
+		cout << "cved::Init failed: " << msg << endl;
+		exit(1);
+	}
+
+	CCved::TRoadVec roads;
+	cved.GetAllRoads(roads);
+	if ( roads.empty() ) {
+		cout << "no roads in " << lri << endl;
+		exit(1);
+	}
+
+	srand(1);
+	for (int n = 0; n < count; n++) {
+		CRoad& road = roads[rand() % roads.size()];
+		double frac = 1.0 * rand() / RAND_MAX;
+		CRoadPos start(road, rand() % road.GetNumLanes(),
+					frac * road.GetLinearLength(), 0.0);
+		if ( !start.IsValid() ) continue;
+
+		CPath path(start);
+		if ( !path.Append(2000.0) || !path.IsValid() ) continue;
+
+		TestTravel(path, start, 5.0);
+		TestTravel(path, start, 137.0);
+		TestModifiedPath(path);
+	}
+
+	cout << s_checks << " checks, " << s_failures << " failures" << endl;
+	return s_failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version: 		$Id: testRouteGraph.cxx,v 1.1 $
+//
+// Author(s):
+// Date:
+//
+// Description:	Test of the route searches of CRouteGraph on small graphs
+// built by hand.  The program prints the routes it finds and exits with a
+// non zero status if any of them is not the expected one.
+//
+// Usage: testRouteGraph
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+
+#include <cvedpub.h>
+#include <routegraph.h>
+
+using namespace CVED;
+using namespace std;
+
+static int s_failures = 0;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// This function adds a corridor with the given identifier between two
+// roads, both traveled in the positive direction.
+//
+static void
+AddEdge(CRouteGraph& graph, int crdrId, int src, int dst, double length)
+{
+	CRouteGraph::TEdge edge;
+
+	edge.srcRoad = src;
+	edge.srcDir  = ePOS;
+	edge.crdrId  = crdrId;
+	edge.dstRoad = dst;
+	edge.dstDir  = ePOS;
+	edge.length  = length;
+	graph.AddEdge(edge);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// This function looks for a route from road 1 to road 5 and compares
+// the corridors of the route with the expected ones; an empty list of
+// expected corridors means that no route should be found.
+//
+static void
+CheckRoute(
+			const CRouteGraph& graph,
+			const char* pName,
+			bool shortest,
+			int maxSteps,
+			const vector<int>& expected
+			)
+{
+	vector<CRouteGraph::TEdge> route;
+	bool found = graph.FindRoute(1, ePOS, 5, ePOS, shortest, maxSteps, route);
+
+	vector<int> crdrs;
+	for (unsigned int i = 0; i < route.size(); i++) {
+		crdrs.push_back(route[i].crdrId);
+	}
+
+	bool ok = ( found == !expected.empty() ) && ( crdrs == expected );
+	cout << pName << ": " << ( found ? "route" : "no route" );
+	for (unsigned int i = 0; i < crdrs.size(); i++) {
+		cout << " " << crdrs[i];
+	}
+	cout << ( ok ? "  ok" : "  FAILED" ) << endl;
+	if ( !ok ) s_failures++;
+}
+
+int
+main(int argc, char* argv[])
+{
+	//
+	// Road 1 leads to road 4 either through roads 2 and 3, which is
+	// short but takes three corridors, or directly, which is long.
+	// Road 4 leads to road 5.  All roads share the same end points, so
+	// the search is not guided by the heuristic.
+	//
+	CRouteGraph graph;
+	graph.SetNumRoads(6);
+	for (int road = 1; road < 6; road++) {
+		graph.SetRoadEnds(road, 0.0, 0.0, 0.0, 0.0);
+	}
+	AddEdge(graph, 1, 1, 2, 1.0);
+	AddEdge(graph, 2, 2, 3, 1.0);
+	AddEdge(graph, 3, 3, 4, 1.0);
+	AddEdge(graph, 4, 1, 4, 10.0);
+	AddEdge(graph, 5, 4, 5, 1.0);
+	graph.Finalize();
+
+	vector<int> longRoute;
+	longRoute.push_back(1);
+	longRoute.push_back(2);
+	longRoute.push_back(3);
+	longRoute.push_back(5);
+
+	vector<int> shortRoute;
+	shortRoute.push_back(4);
+	shortRoute.push_back(5);
+
+	vector<int> noRoute;
+
+	// the shortest route fits within the limit
+	CheckRoute(graph, "shortest, 4 steps", true, 4, longRoute);
+
+	// the shortest route reaches road 4 through more corridors than the
+	// limit leaves room for, but the direct corridor still fits
+	CheckRoute(graph, "shortest, 3 steps", true, 3, shortRoute);
+	CheckRoute(graph, "shortest, 2 steps", true, 2, shortRoute);
+	CheckRoute(graph, "shortest, 1 step", true, 1, noRoute);
+
+	// a second search must not be affected by the cached route tree
+	CheckRoute(graph, "shortest again, 3 steps", true, 3, shortRoute);
+
+	CheckRoute(graph, "fewest steps", false, 25, shortRoute);
+
+	if ( s_failures > 0 ) {
+		cout << s_failures << " failures" << endl;
+		return 1;
+	}
+	cout << "all tests passed" << endl;
+	return 0;
+}
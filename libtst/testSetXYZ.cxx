@@ -0,0 +1,158 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright 1998 by NADS & Simulation Center, The University of
+//     Iowa.  All rights reserved.
+//
+// Version: 		$Id: testSetXYZ.cxx,v 1.1 $
+//
+// Author(s):
+// Date:
+//
+// Description:	Micro-benchmark of CRoadPos::SetXYZ.  Random points are
+// generated on the roads and intersections of a database and the number
+// of points located per second is reported, both for cold searches
+// (a new CRoadPos for every point) and for warm searches (one CRoadPos
+// following a sequence of nearby points).
+//
+// Usage: testSetXYZ [lri file] [number of points]
+//
+/////////////////////////////////////////////////////////////////////////////
+#ifdef _WIN32
+#include <iostream>
+#elif __sgi
+#include <iostream.h>
+#endif
+#include <chrono>
+
+#include <cved.h>
+#include <cvedpub.h>
+
+using namespace CVED;
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// This function generates points on the roads and intersections of the
+// database.  Each road or corridor is chosen with equal probability and
+// the point is placed at a random distance and offset on it.
+//
+void
+GeneratePoints(const CCved& cved, int count, vector<CPoint3D>& points)
+{
+	CCved::TRoadVec      roads;
+	CCved::TIntrsctnVec  intrsctns;
+	vector<CCrdr>        crdrs;
+
+	cved.GetAllRoads(roads);
+	cved.GetAllIntersections(intrsctns);
+	for (unsigned int i = 0; i < intrsctns.size(); i++) {
+		TCrdrVec  v;
+
+		intrsctns[i].GetAllCrdrs(v);
+		crdrs.insert(crdrs.end(), v.begin(), v.end());
+	}
+
+	int numItems = (int)(roads.size() + crdrs.size());
+
+	points.clear();
+	while ( numItems > 0 && (int)points.size() < count ) {
+		int    item = rand() % numItems;
+		double frac = 1.0 * rand() / RAND_MAX;
+		double ofs  = 3.0 * rand() / RAND_MAX - 1.5;
+
+		if ( item < (int)roads.size() ) {
+			CRoad& road = roads[item];
+			CRoadPos pos(road, rand() % road.GetNumLanes(),
+						frac * road.GetLinearLength(), ofs);
+
+			if ( pos.IsValid() ) points.push_back(pos.GetXYZ());
+		}
+		else {
+			CCrdr& crdr = crdrs[item - roads.size()];
+			CRoadPos pos(crdr.GetIntrsctn(), crdr, frac * crdr.GetLength(), ofs);
+
+			if ( pos.IsValid() ) points.push_back(pos.GetXYZ());
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// This function times SetXYZ on the given points and prints the
+// throughput.
+//
+void
+TimeSetXYZ(const CCved& cved, const vector<CPoint3D>& points, bool warm)
+{
+	int numFound = 0;
+	int numCold  = 0;
+	CRoadPos warmPos(cved);
+
+	auto start = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < points.size(); i++) {
+		bool cold;
+
+		if ( warm ) {
+			if ( warmPos.SetXYZ(points[i], 0, &cold) ) numFound++;
+		}
+		else {
+			CRoadPos pos(cved);
+
+			if ( pos.SetXYZ(points[i], 0, &cold) ) numFound++;
+		}
+		if ( cold ) numCold++;
+	}
+	auto stop = chrono::steady_clock::now();
+
+	double secs = chrono::duration<double>(stop - start).count();
+
+	cout << (warm ? "warm" : "cold") << ": " << points.size() << " points, "
+		<< numFound << " found, " << numCold << " cold searches, "
+		<< secs << " s, " << (secs > 0.0 ? points.size() / secs : 0.0)
+		<< " points/s" << endl;
+}
+
+
+int
+main(int argc, char **argv)
+{
+	string  lri   = argc > 1 ? argv[1] : "smallb.lri";
+	int     count = argc > 2 ? atoi(argv[2]) : 100000;
+	CCved   cved;
+	string  msg;
+
+	if (!cved.Configure(CCved::eCV_SINGLE_USER, 0.1f, 2))
+	{
+		cout << "cved::configure failed: " << __LINE__ << endl;
+		exit(1);
+	}
+
+	if ( cved.Init(lri, msg) == false ) {
+		cout << "cved::Init failed: " << msg << endl;
+		exit(1);
+	}
+
+	vector<CPoint3D>  points;
+
+	srand(1);
+	GeneratePoints(cved, count, points);
+
+	// random points exercise the cold search
+	TimeSetXYZ(cved, points, false);
+
+	// walk 1 ft at a time from each of the points, so a single CRoadPos
+	// moves in small steps and mostly uses the warm search
+	vector<CPoint3D>  track;
+	for (unsigned int i = 0; i < points.size(); i++) {
+		CRoadPos pos(cved, points[i]);
+		if ( !pos.IsValid() ) continue;
+		for (int step = 0; step < 10; step++) {
+			if ( pos.Travel(1.0) == CRoadPos::eERROR || !pos.IsValid() ) break;
+			track.push_back(pos.GetXYZ());
+		}
+		if ( track.size() >= points.size() ) break;
+	}
+	TimeSetXYZ(cved, track, true);
+
+	return 0;
+}
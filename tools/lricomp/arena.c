@@ -0,0 +1,214 @@
+/*****************************************************************************
+ * (C) Copyright 1999 by National Advanced Driving Simulator, the University
+ *     of Iowa.  All rights reserved.
+ *
+ * Version: 		$Id: arena.c,v 1.1 $
+ *
+ * Author:
+ *
+ * Date:
+ *
+ * Description:
+ *	Storage for the parse tree built by the lri parser.  The nodes of the
+ *	parse tree are carved out of large blocks instead of being allocated
+ *	one at a time, so nodes created one after the other are adjacent in
+ *	memory and the entire tree is released with a single call once code
+ *	generation is done.  Identifiers returned by the lexical analyzer are
+ *	interned in the same storage, so a road or intersection name that is
+ *	referenced many times in the input is stored only once.
+ *
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "parser.h"
+#include "err.h"
+
+#define cARENA_BLOCK_SIZE     (1024*1024)
+#define cARENA_ALIGN(n)       (((n) + 7) & ~((size_t)7))
+#define cINITIAL_INTERN_SIZE  4096			/* must be a power of 2 */
+
+/*
+ * a block of parse tree storage; the storage follows the header
+ */
+typedef struct ArenaBlock {
+	struct ArenaBlock*	pNext;		/* previously allocated block */
+	size_t				size;		/* bytes of storage in the block */
+	size_t				used;		/* bytes handed out so far */
+} TArenaBlock;
+
+static TArenaBlock*	spArena        = NULL;
+static char**		spInternTable  = NULL;	/* open addressing hash table */
+static size_t		sInternSize    = 0;		/* capacity of the table */
+static size_t		sInternCount   = 0;		/* strings in the table */
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: LriArenaAlloc
+ *
+ *	NON-REENTRANT
+ *
+ *	This function returns zero initialized storage for a node of the parse
+ *	tree.  The storage remains valid until LriArenaFree is called and must
+ *	not be passed to free().
+ *
+ *	Input:
+ *		size:	number of bytes needed
+ *
+ *	Return Value:
+ *		pointer to the storage; the program exits if no memory is available
+ *
+ *---------------------------------------------------------------------------*/
+void *LriArenaAlloc(size_t size)
+{
+	char* pData;
+
+	size = cARENA_ALIGN(size);
+	if ( spArena == NULL || spArena->used + size > spArena->size ) {
+		size_t			blockSize;
+		TArenaBlock*	pBlock;
+
+		blockSize = (size > cARENA_BLOCK_SIZE) ? size : cARENA_BLOCK_SIZE;
+		pBlock = (TArenaBlock *)malloc(
+					cARENA_ALIGN(sizeof(TArenaBlock)) + blockSize);
+		if ( pBlock == NULL ) {
+			lrierr(ePARSE_ARENA_ALLOC_FAIL, "");
+			exit(1);
+		}
+		pBlock->pNext = spArena;
+		pBlock->size  = blockSize;
+		pBlock->used  = 0;
+		spArena = pBlock;
+	}
+
+	pData = (char *)spArena + cARENA_ALIGN(sizeof(TArenaBlock)) + spArena->used;
+	spArena->used += size;
+	memset(pData, 0, size);
+
+	return pData;
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: HashString
+ *
+ *	This function computes the hash code used by the intern table.
+ *
+ *---------------------------------------------------------------------------*/
+static size_t HashString(const char* pStr)
+{
+	size_t hash = 5381;
+
+	while ( *pStr )
+		hash = hash * 33 + (unsigned char)*pStr++;
+
+	return hash;
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: GrowInternTable
+ *
+ *	NON-REENTRANT
+ *
+ *	This function doubles the capacity of the intern table and rehashes
+ *	the strings it contains.
+ *
+ *---------------------------------------------------------------------------*/
+static void GrowInternTable(void)
+{
+	size_t	newSize = sInternSize ? 2 * sInternSize : cINITIAL_INTERN_SIZE;
+	char**	pNew;
+	size_t	i;
+
+	pNew = (char **)calloc(newSize, sizeof(char *));
+	if ( pNew == NULL ) {
+		lrierr(ePARSE_ARENA_ALLOC_FAIL, "");
+		exit(1);
+	}
+
+	for ( i = 0; i < sInternSize; i++ ) {
+		if ( spInternTable[i] ) {
+			size_t slot = HashString(spInternTable[i]) & (newSize - 1);
+
+			while ( pNew[slot] )
+				slot = (slot + 1) & (newSize - 1);
+			pNew[slot] = spInternTable[i];
+		}
+	}
+
+	free(spInternTable);
+	spInternTable = pNew;
+	sInternSize   = newSize;
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: LriInternString
+ *
+ *	NON-REENTRANT
+ *
+ *	This function returns the unique copy of the specified string, adding
+ *	it to the intern table the first time it is seen.  The returned string
+ *	is shared and must not be modified or freed.
+ *
+ *	Input:
+ *		pStr:	string to intern
+ *
+ *	Return Value:
+ *		pointer to the interned copy of the string
+ *
+ *---------------------------------------------------------------------------*/
+char *LriInternString(const char* pStr)
+{
+	size_t	slot;
+	size_t	len;
+
+	if ( 2 * (sInternCount + 1) > sInternSize )
+		GrowInternTable();
+
+	slot = HashString(pStr) & (sInternSize - 1);
+	while ( spInternTable[slot] ) {
+		if ( !strcmp(spInternTable[slot], pStr) )
+			return spInternTable[slot];
+		slot = (slot + 1) & (sInternSize - 1);
+	}
+
+	len = strlen(pStr);
+	spInternTable[slot] = (char *)LriArenaAlloc(len + 1);
+	memcpy(spInternTable[slot], pStr, len + 1);
+	sInternCount++;
+
+	return spInternTable[slot];
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: LriArenaFree
+ *
+ *	NON-REENTRANT
+ *
+ *	This function releases the entire parse tree, including the interned
+ *	strings.
+ *
+ *---------------------------------------------------------------------------*/
+void LriArenaFree(void)
+{
+	while ( spArena ) {
+		TArenaBlock* pBlock = spArena;
+
+		spArena = spArena->pNext;
+		free(pBlock);
+	}
+
+	free(spInternTable);
+	spInternTable = NULL;
+	sInternSize   = 0;
+	sInternCount  = 0;
+}
@@ -113,7 +113,9 @@ static void BuildObjQTree(void);
 void SetCharPool(const char*); 
 static void SetAttrPool(const TAttribute*, int*, int);
 static void SetRepObjPool(const TRepObj*, int*);
-static void SetCntrlPntPool(const TControlPoint*, int, const TLaneDef*, int);
+static void SetCntrlPntPool(
+			const char*, const TControlPoint*, int, const TLaneDef*, int);
+static void CopyCntrlPntGeometry(cvTCntrlPnt*, const cvTCntrlPnt*);
 static void SetAttrName(void);
 static void BuildLatCntrlPntPool( const TCurveDef*, float, int*);
 static void BuildLatPool(void);
@@ -418,7 +420,12 @@ void GenerateCode(
 		int numOfLanes = pCurrentRoad->lanelist.n_lanes;
 		pRoadPool[sizeOfRoadPool-1].numOfLanes = numOfLanes;
 		pRoadPool[sizeOfRoadPool-1].laneIdx = sizeOfLanePool;
-		SetCntrlPntPool(pCntrlPnt, numCntrlPnt, pLane, numOfLanes);
+		SetCntrlPntPool(
+					pCurrentRoad->roadName, 
+					pCntrlPnt, 
+					numCntrlPnt, 
+					pLane, 
+					numOfLanes);
 
 		pRoadPool[sizeOfRoadPool-1].roadLengthLinear = 
 					pCntrlPntPool[sizeOfCntrlPntPool-1].distance;
@@ -968,7 +975,12 @@ static float GetCntrlPntDistance(int cur)
  *	This function reads the information of longitudinal control points of the
  *	roads and store it in the longitudinal control point pool. 
  *
+ *	When compiling incrementally, the geometry of a road whose control
+ *	points are unchanged since the last compile is copied from the artifact
+ *	cache; only the lane, lateral and name indexes are generated again.
+ *
  *	Input:
+ *		pName:		name of the road
  *		pCntrlPnt:	pointer pointing to TControlPoint that contains informa-
  *					tion of longitudinal control points of the road
  *		numCntrlPnt:	number of the longitudinal control points of the road
@@ -978,6 +990,7 @@ static float GetCntrlPntDistance(int cur)
  *
  *---------------------------------------------------------------------------*/
 static void SetCntrlPntPool(
+			const char*				pName,
 			const TControlPoint*	pCntrlPnt,
 			int						numCntrlPnt,
 			const TLaneDef*			pLane,
@@ -997,6 +1010,8 @@ static void SetCntrlPntPool(
 	TVector3D*	secondDeriv = NULL, firstDeriv;
 	float*		tPars = NULL;
 	float		tPar1, tPar2;
+	unsigned int hash = 0;
+	char		cacheKey[cMAX_WORDLENGTH + 8];
 
 	// compute necessary size to add new elements
 	sizeOfCntrlPntPool += numCntrlPnt;
@@ -1148,6 +1163,36 @@ static void SetCntrlPntPool(
 			pCntrlPntPool[oldSize+cur].nameIdx = 0;
 	}
 
+	/*
+	 * Look for the geometry of the road in the artifact cache.  The
+	 * geometry depends only on the location and normal of the control
+	 * points, so those are all that go into the hash.
+	 */
+	if ( gIncremental ) {
+		hash = HashArtifactData(&numCntrlPnt, sizeof(numCntrlPnt), 0);
+		for (cur=0; cur<numCntrlPnt; cur++){
+			float coords[6];
+
+			coords[0] = pCntrlPnt[cur].x;
+			coords[1] = pCntrlPnt[cur].y;
+			coords[2] = pCntrlPnt[cur].z;
+			coords[3] = pCntrlPnt[cur].i;
+			coords[4] = pCntrlPnt[cur].j;
+			coords[5] = pCntrlPnt[cur].k;
+			hash = HashArtifactData(coords, sizeof(coords), hash);
+		}
+		sprintf(cacheKey, "R:%s", pName);
+
+		vector<cvTCntrlPnt> cached(numCntrlPnt);
+		if ( GetCachedArtifact(cacheKey, hash, &cached[0], 
+					numCntrlPnt * sizeof(cvTCntrlPnt)) ) {
+			for (cur=0; cur<numCntrlPnt; cur++){
+				CopyCntrlPntGeometry(&pCntrlPntPool[oldSize+cur], &cached[cur]);
+			}
+			return;
+		}
+	}
+
 	/*
 	 * Linear Tangent, Right and Linear Acc. Dist. and Linear Dist. to Next
 	 * Control Point:
@@ -1392,6 +1437,13 @@ static void SetCntrlPntPool(
 	spl.calc();
     sp2.calc();
 
+	/*
+	 * When the radius of the first control point cannot be evaluated, it
+	 * is copied from the last control point of the previous road, which
+	 * is not part of the hash of this road, so the result is not cached.
+	 */
+	int cacheable = 1;
+
 	CCubicSplinePos  pos;
 	for (cur=0; cur<numCntrlPnt; cur++){
 		cvTCntrlPnt *pC = &pCntrlPntPool[oldSize+cur];
@@ -1403,8 +1455,11 @@ static void SetCntrlPntPool(
 				sp2.AdvanceMidway(pos,0.5);
 			if (sp2.evalCurveRadiusAvgOverRegion(pos,15,r1)){
 				pC->radius = r1;
-			}else{
+			}else if (cur > 0){
 				pC->radius = (pC-1)->radius;
+			}else{
+				pC->radius = ( oldSize > 0 ) ? (pC-1)->radius : 0.0;
+				cacheable = 0;
 			}
 		}
         if (numCntrlPnt>1){
@@ -1414,6 +1469,11 @@ static void SetCntrlPntPool(
         }
 	}
 
+	if ( gIncremental && cacheable ) {
+		PutCachedArtifact(cacheKey, hash, &pCntrlPntPool[oldSize],
+					numCntrlPnt * sizeof(cvTCntrlPnt));
+	}
+
 	/* 
 	 * Deallocate memory.
 	 */
@@ -1422,6 +1482,37 @@ static void SetCntrlPntPool(
 	free( tPars );
 }
 
+/*----------------------------------------------------------------------------*
+ *
+ *	Name: CopyCntrlPntGeometry
+ * 
+ *	This function copies the fields of a longitudinal control point that
+ *	are derived from the shape of the road, leaving alone the fields that
+ *	index into other pools.
+ *
+ *	Input:
+ *		pDst:	control point to receive the geometry
+ *		pSrc:	control point to copy the geometry from
+ *
+ *---------------------------------------------------------------------------*/
+static void CopyCntrlPntGeometry(cvTCntrlPnt* pDst, const cvTCntrlPnt* pSrc)
+{
+	pDst->tangVecCubic         = pSrc->tangVecCubic;
+	pDst->rightVecCubic        = pSrc->rightVecCubic;
+	pDst->tangVecLinear        = pSrc->tangVecLinear;
+	pDst->rightVecLinear       = pSrc->rightVecLinear;
+	pDst->hermite[0]           = pSrc->hermite[0];
+	pDst->hermite[1]           = pSrc->hermite[1];
+	pDst->hermite[2]           = pSrc->hermite[2];
+	pDst->cummulativeLinDist   = pSrc->cummulativeLinDist;
+	pDst->cummulativeCubicDist = pSrc->cummulativeCubicDist;
+	pDst->distToNextLinear     = pSrc->distToNextLinear;
+	pDst->distToNextCubic      = pSrc->distToNextCubic;
+	pDst->sn                   = pSrc->sn;
+	pDst->st                   = pSrc->st;
+	pDst->radius               = pSrc->radius;
+}
+
 /*--------------------------------------------------------------------*
  *
  *	Name: SetAttrName
@@ -2250,6 +2341,9 @@ static void SetCrdrCntrlPntPool(const char* pName, TCrdrCurveList* pCurveList)
 	TVector3D	linTang;
 	TVector3D	linRight;
 	TPoint3D	currPt,prevPt,nextPt;
+	unsigned int hash = 0;
+	char		cacheKey[512];
+	vector<double> radii(numCntrl);
 
 
 	sizeOfCrdrCntrlPntPool += numCntrl;
@@ -2340,6 +2434,27 @@ static void SetCrdrCntrlPntPool(const char* pName, TCrdrCurveList* pCurveList)
 		}
 	}
 
+	/*
+	 * The radius of curvature depends only on the location of the control
+	 * points; reuse the radii of an unchanged corridor when compiling
+	 * incrementally.
+	 */
+	if ( gIncremental ) {
+		hash = HashArtifactData(&numCntrl, sizeof(numCntrl), 0);
+		for (i=0; i<numCntrl; i++){
+			hash = HashArtifactData(&pCrdrCurve[i].x, sizeof(float), hash);
+			hash = HashArtifactData(&pCrdrCurve[i].y, sizeof(float), hash);
+		}
+		sprintf(cacheKey, "C:%s", pName);
+		if ( GetCachedArtifact(cacheKey, hash, &radii[0], 
+					numCntrl * sizeof(double)) ) {
+			for (i=0; i<numCntrl; i++){
+				pCrdrCntrlPntPool[oldSize+i].radius = radii[i];
+			}
+			return;
+		}
+	}
+
 	/*
 	 * Now calculate the radius of curvature.  We build a
 	 * spline and then use the spline's radius of curvature calculation
@@ -2370,6 +2485,12 @@ static void SetCrdrCntrlPntPool(const char* pName, TCrdrCurveList* pCurveList)
 	"Can Not calculate curve for %s\n", pName);
 					exit(-1);			
 			}
+		radii[i] = pC->radius;
+	}
+
+	if ( gIncremental ) {
+		PutCachedArtifact(cacheKey, hash, &radii[0], 
+					numCntrl * sizeof(double));
 	}
 }
 
@@ -3364,6 +3485,39 @@ void WriteOutputFile(
 //	delete [] pCrdrMrgDstPool;
 	ofs += sizeOfCrdrMrgDstPool * sizeof(cvTCrdrMrgDst);
 	padMultiple(8, pOut, &ofs);
+
+	// the route hierarchy is optional; a count of 0 means it is absent
+	header.routeHierNodeCount = sizeOfRouteHierNodePool;
+	header.routeHierNodeOfs = ofs;
+	n = fwrite(
+			pRouteHierNodePool,
+			sizeof(cvTRouteHierNode),
+			sizeOfRouteHierNodePool,
+			pOut);
+	if (n != sizeOfRouteHierNodePool){
+		lrierr( eMEM_WRITE_FAIL,
+				"%s .",
+				"when writing route hierarchy node pool to binary file");
+		exit(1);
+	}
+	ofs += sizeOfRouteHierNodePool * sizeof(cvTRouteHierNode);
+	padMultiple(8, pOut, &ofs);
+
+	header.routeHierEdgeCount = sizeOfRouteHierEdgePool;
+	header.routeHierEdgeOfs = ofs;
+	n = fwrite(
+			pRouteHierEdgePool,
+			sizeof(cvTRouteHierEdge),
+			sizeOfRouteHierEdgePool,
+			pOut);
+	if (n != sizeOfRouteHierEdgePool){
+		lrierr( eMEM_WRITE_FAIL,
+				"%s .",
+				"when writing route hierarchy edge pool to binary file");
+		exit(1);
+	}
+	ofs += sizeOfRouteHierEdgePool * sizeof(cvTRouteHierEdge);
+	padMultiple(8, pOut, &ofs);
 			
 
 	header.roadOfs   = ofs;
@@ -54,7 +54,9 @@ static char *errMsgs[] = {
 		"Name of either sign or light in crdr can not be found in object pool.",
 		"Memory allocation for envArea pool failed.",
 		"Memory allocation for envInfo pool failed.",
-		"Memory allocation for corridor merge distance point pool failed."
+		"Memory allocation for corridor merge distance point pool failed.",
+		"Memory allocation for parse tree failed.",
+		"Memory allocation for route hierarchy pool failed."
 };
 
 FILE *logFile = 0;
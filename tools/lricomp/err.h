@@ -60,7 +60,9 @@ typedef enum {
 	eBAD_SIGN_OR_LIGHT_NAME         = 28,
 	eENV_AREA_POOL_ALLOC_FAIL		= 29,
 	eENV_INFO_POOL_ALLOC_FAIL		= 30,
-	eCRDR_MRG_DST_ALLOC_FAIL		= 31
+	eCRDR_MRG_DST_ALLOC_FAIL		= 31,
+	ePARSE_ARENA_ALLOC_FAIL			= 32,
+	eROUTE_HIER_POOL_ALLOC_FAIL		= 33
 }TErrorType;
 
 /*************************************************************************
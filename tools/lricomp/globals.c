@@ -79,6 +79,12 @@ int				sizeOfIntrsctnRefPool = 0;
 cvTCrdrMrgDst	*pCrdrMrgDstPool = NULL;
 int				sizeOfCrdrMrgDstPool = 0;
 
+cvTRouteHierNode	*pRouteHierNodePool = NULL;
+int				sizeOfRouteHierNodePool = 0;
+
+cvTRouteHierEdge	*pRouteHierEdgePool = NULL;
+int				sizeOfRouteHierEdgePool = 0;
+
 char*		reservedAttrNames[cCV_NUM_RESERVED_ATTR] = {
 	"SpeedLimit", "LaneChangeRules", "PassingRules", 
 	"Merge", "DrivingLane", "BicycleLane",
@@ -100,4 +106,6 @@ int         gOvrdVersionMin = 0;
 int         gOvrdVersion1   = 0;
 int         gOvrdVersion2   = 0;
 int         gOvrdVersion3   = 0;
+int         gIncremental    = 0;
+int         gRouteHierarchy = 0;
 int			gNoMinusInNames = 0;
\ No newline at end of file
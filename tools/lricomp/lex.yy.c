@@ -457,8 +457,8 @@ case 42:
 
 # line 272 "lexan.l"
 {
-							  yylval.strval = (char *) calloc(1,(strlen((const char *)yytext)+1)*sizeof(char));
-					 		  strcpy(yylval.strval,(const char *)yytext);
+							  /* names repeat a lot, keep one copy of each */
+					 		  yylval.strval = LriInternString((const char *)yytext);
 					 		  _lriDBG(_vePrintf("%s",yylval.strval));
 				         	  return(LRI_IDENTIFIER);
                             }
@@ -0,0 +1,283 @@
+/***************************************************************************
+ * (C) Copyright 1998 by NADS & Simulation Center The University of Iowa
+ * and The University of Iowa.  All rights reserved.
+ *
+ * $Id: lricache.cxx,v 1.1 $
+ *
+ * Author(s) :
+ * Date:
+ *
+ * Description:
+ * This file contains the artifact cache used by the lri compiler to
+ * support incremental compilation.  Each cached artifact is a pool
+ * fragment (e.g. the geometry of the control points of a road) that
+ * is keyed by the name of the block that produced it along with a
+ * content hash of the source data of that block.  When the same block
+ * is compiled again with identical source data, the fragment is copied
+ * from the cache instead of being recomputed.  Only geometry that does
+ * not depend on the position of the block in the pools is cached, so
+ * the indexes into the pools are always re-linked by the code generator.
+ *
+ **************************************************************************/
+#ifdef _WIN32
+#include <ostream>
+#include <iostream>
+#elif __sgi
+#include <typeinfo>
+#include <iostream.h>
+#endif
+
+#include <vector>
+#include <map>
+#include <string>
+
+using namespace std;
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "parser.h"
+
+#define cLRI_CACHE_MAGIC     0x4349524C		/* "LRIC" */
+#define cLRI_CACHE_VERSION   1
+
+/*
+ * a single cached pool fragment
+ */
+typedef struct TArtifact {
+	unsigned int	hash;		/* content hash of the source block */
+	vector<char>	data;		/* the generated pool fragment */
+	bool			used;		/* referenced by the current compile */
+} TArtifact;
+
+static map<string, TArtifact> sArtifacts;
+static int sNumHits   = 0;
+static int sNumMisses = 0;
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: HashArtifactData
+ *
+ *	This function accumulates the specified bytes into a content hash using
+ *	the 32 bit FNV-1a algorithm.  To hash a block consisting of several
+ *	pieces, pass the hash returned by the previous call as the seed.
+ *
+ *	Input:
+ *		pData:	pointer to the data to hash
+ *		size:	number of bytes to hash
+ *		seed:	hash of the preceding data, or 0 to start a new hash
+ *
+ *	Return Value:
+ *		the updated hash
+ *
+ *---------------------------------------------------------------------------*/
+unsigned int HashArtifactData(const void* pData, size_t size, unsigned int seed)
+{
+	const unsigned char* pByte = (const unsigned char *)pData;
+	unsigned int hash = seed ? seed : 2166136261u;
+	size_t i;
+
+	for ( i = 0; i < size; i++ ) {
+		hash ^= pByte[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: GetCachedArtifact
+ *
+ *	NON-REENTRANT
+ *
+ *	This function looks for a pool fragment that was generated from a block
+ *	with the specified key and content hash.  On success the fragment is
+ *	copied into the buffer provided by the caller.
+ *
+ *	Input:
+ *		pKey:	unique name of the block (e.g. "R:roadName")
+ *		hash:	content hash of the source data of the block
+ *		pDst:	buffer that receives the fragment
+ *		size:	size of the fragment in bytes
+ *
+ *	Return Value:
+ *		true if the fragment was found in the cache, false otherwise
+ *
+ *---------------------------------------------------------------------------*/
+bool GetCachedArtifact(
+			const char*		pKey,
+			unsigned int	hash,
+			void*			pDst,
+			size_t			size)
+{
+	map<string, TArtifact>::iterator itr = sArtifacts.find(pKey);
+
+	if ( itr == sArtifacts.end() || itr->second.hash != hash ||
+				itr->second.data.size() != size ) {
+		sNumMisses++;
+		return false;
+	}
+
+	if ( size > 0 )
+		memcpy(pDst, &itr->second.data[0], size);
+	itr->second.used = true;
+	sNumHits++;
+	return true;
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: PutCachedArtifact
+ *
+ *	NON-REENTRANT
+ *
+ *	This function stores a freshly generated pool fragment in the cache,
+ *	replacing any fragment previously stored under the same key.
+ *
+ *	Input:
+ *		pKey:	unique name of the block
+ *		hash:	content hash of the source data of the block
+ *		pSrc:	the generated fragment
+ *		size:	size of the fragment in bytes
+ *
+ *---------------------------------------------------------------------------*/
+void PutCachedArtifact(
+			const char*		pKey,
+			unsigned int	hash,
+			const void*		pSrc,
+			size_t			size)
+{
+	TArtifact& artifact = sArtifacts[pKey];
+
+	artifact.hash = hash;
+	artifact.used = true;
+	artifact.data.assign((const char *)pSrc, (const char *)pSrc + size);
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: LoadArtifactCache
+ *
+ *	NON-REENTRANT
+ *
+ *	This function reads the artifacts saved by a previous compile.  A
+ *	missing cache file is not an error; neither is a cache file produced
+ *	by a different version of the compiler, in which case it is ignored
+ *	and all blocks are compiled from scratch.
+ *
+ *	Input:
+ *		pFileName:	name of the cache file
+ *
+ *---------------------------------------------------------------------------*/
+void LoadArtifactCache(const char* pFileName)
+{
+	FILE*			pFile;
+	unsigned int	head[5];
+	unsigned int	i;
+
+	sArtifacts.clear();
+	pFile = fopen(pFileName, "rb");
+	if ( pFile == NULL )
+		return;
+
+	if ( fread(head, sizeof(head), 1, pFile) != 1 ||
+				head[0] != cLRI_CACHE_MAGIC ||
+				head[1] != cLRI_CACHE_VERSION ||
+				head[2] != sizeof(cvTCntrlPnt) ||
+				head[3] != sizeof(cvTCrdrCntrlPnt) ) {
+		fprintf(stderr, "Ignoring out of date cache file '%s'.\n", pFileName);
+		fclose(pFile);
+		return;
+	}
+
+	for ( i = 0; i < head[4]; i++ ) {
+		unsigned int	sizes[3];		/* key size, hash, data size */
+		char			key[512];
+		TArtifact		artifact;
+
+		if ( fread(sizes, sizeof(sizes), 1, pFile) != 1 ||
+				sizes[0] >= sizeof(key) ||
+				fread(key, 1, sizes[0], pFile) != sizes[0] ) {
+			break;
+		}
+		key[sizes[0]] = '\0';
+
+		artifact.hash = sizes[1];
+		artifact.used = false;
+		artifact.data.resize(sizes[2]);
+		if ( sizes[2] > 0 &&
+				fread(&artifact.data[0], 1, sizes[2], pFile) != sizes[2] ) {
+			break;
+		}
+		sArtifacts[key] = artifact;
+	}
+
+	if ( i != head[4] ) {
+		fprintf(stderr, "Cache file '%s' is truncated, ignoring it.\n",
+					pFileName);
+		sArtifacts.clear();
+	}
+	fclose(pFile);
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: SaveArtifactCache
+ *
+ *	NON-REENTRANT
+ *
+ *	This function writes the artifacts used by the current compile to the
+ *	cache file.  Artifacts of blocks that no longer exist in the source
+ *	are dropped so the cache does not grow without bounds.
+ *
+ *	Input:
+ *		pFileName:	name of the cache file
+ *
+ *---------------------------------------------------------------------------*/
+void SaveArtifactCache(const char* pFileName)
+{
+	FILE*			pFile;
+	unsigned int	head[5];
+	map<string, TArtifact>::const_iterator itr;
+
+	pFile = fopen(pFileName, "wb");
+	if ( pFile == NULL ) {
+		fprintf(stderr, "Cannot write cache file '%s'.  ", pFileName);
+		perror("");
+		return;
+	}
+
+	head[0] = cLRI_CACHE_MAGIC;
+	head[1] = cLRI_CACHE_VERSION;
+	head[2] = sizeof(cvTCntrlPnt);
+	head[3] = sizeof(cvTCrdrCntrlPnt);
+	head[4] = 0;
+	for ( itr = sArtifacts.begin(); itr != sArtifacts.end(); itr++ ) {
+		if ( itr->second.used )
+			head[4]++;
+	}
+	fwrite(head, sizeof(head), 1, pFile);
+
+	for ( itr = sArtifacts.begin(); itr != sArtifacts.end(); itr++ ) {
+		unsigned int sizes[3];
+
+		if ( !itr->second.used )
+			continue;
+
+		sizes[0] = (unsigned int)itr->first.size();
+		sizes[1] = itr->second.hash;
+		sizes[2] = (unsigned int)itr->second.data.size();
+		fwrite(sizes, sizeof(sizes), 1, pFile);
+		fwrite(itr->first.c_str(), 1, sizes[0], pFile);
+		if ( sizes[2] > 0 )
+			fwrite(&itr->second.data[0], 1, sizes[2], pFile);
+	}
+	fclose(pFile);
+
+	printf(" Reused %d of %d cached blocks.\n", sNumHits, sNumHits+sNumMisses);
+}
@@ -365,12 +365,14 @@ void usage(const char *pPgmName)
 {
 	fprintf(stderr, "%s (V%d.%d): incorrect usage.\n", pPgmName,
 		gGetMajorCvedVersionNum(), gGetMinorCvedVersionNum());
-	fprintf(stderr, "Usage: %s [-ct num] [-gap num] [-hs num] [-nc] [-nodash c] [-v1 Ver] [-v2 Ver] [-debug] [-tlex] in out \n", pPgmName);
+	fprintf(stderr, "Usage: %s [-cache file] [-ct num] [-gap num] [-hs num] [-nc] [-nodash c] [-routes] [-v1 Ver] [-v2 Ver] [-debug] [-tlex] in out \n", pPgmName);
 	fprintf(stderr, 
 "\t-nc     perform no corrections on spline data\n"
+"\t-cache  compile incrementally, reusing the geometry of unchanged roads\n\t        and corridors saved in [file] by the previous compile\n"
 "\t-ct     corridor tolerance.  Corridors can be [num] units away from\n\t        their source or destination lanes without generating an error\n"
 "\t-hs     hermite spline scale factor\n"
 "\t-nodash c   replace '-' chars in road/intersection names with c\n"
+"\t-routes precompute a route hierarchy for fast shortest route queries\n"
 "\t-v1     override major version number written to output file\n"
 "\t-v2     override minor version number written to output file\n"
 "\t-v3,v4,v5 override externsion version numbers written to output file\n"
@@ -1323,6 +1325,7 @@ void main (int argc, char *argv[])
 	int         token;
 	int         arg;
 	char		binLRI[256] = { 0 };
+	char		cacheFile[256] = { 0 };
 
 #ifdef _WIN32
 	::SetUnhandledExceptionFilter(FatalExceptionHandler);
@@ -1389,6 +1392,16 @@ void main (int argc, char *argv[])
 			gGapTolerance = atof( argv[arg] );
 		}
 		else
+		if ( !strcmp(argv[arg], "-routes") ) {
+			gRouteHierarchy = 1;
+		}
+		else
+		if ( !strcmp(argv[arg], "-cache") ) {
+			arg++;
+			gIncremental = 1;
+			strncpy(cacheFile, argv[arg], sizeof(cacheFile)-1);
+		}
+		else
 		if ( argv[arg][0] == '-' ) {
 			usage(argv[0]);
 		}
@@ -1463,38 +1476,37 @@ void main (int argc, char *argv[])
 			&pObjPool,
 			&sizeOfObjPool);
 
+	if ( gIncremental )
+		LoadArtifactCache(cacheFile);
+
 	GenerateCode(gpRoadList, gpInterList, gpElevMaps, postPool, elevMapPool);
 
 	// Free memory for the data structures maintained by the parser.
 	// Set pointers to zero to catch any access that takes place 
-	// after memory is freed.
+	// after memory is freed.  The nodes themselves live in the parse
+	// tree arena; only the expandable arrays hanging off them have
+	// to be freed one by one.
 
 	{
+		TIntersection *pInt;
+		TCrdr         *pCrdr;
+		TRoads        *pRd;
 
-		while ( gpInterList ) {
-			TIntersection *pInt = gpInterList;
-
-			gpInterList = gpInterList->pNext;
-			free(pInt);
+		for ( pInt = gpInterList; pInt; pInt = pInt->pNext ) {
+			for ( pCrdr = pInt->pCrdr; pCrdr; pCrdr = pCrdr->pNext ) {
+				free(pCrdr->CrdrCurveList.pCrdrCurve);
+			}
 		}
 		gpInterList = 0;
 
-		while ( gpRoadList ) {
-			TRoads *pRd = gpRoadList;
-
-			gpRoadList = gpRoadList->pNext;
-			free(pRd);
+		for ( pRd = gpRoadList; pRd; pRd = pRd->pNext ) {
+			free(pRd->longitCurve.pCpointList);
 		}
 		gpRoadList = 0;
-
-		while ( gpElevMaps ) {
-			TElevMap *pMap = gpElevMaps;
-
-			gpElevMaps = gpElevMaps->pNextElevMap;
-			free(pMap);
-		}
 		gpElevMaps = 0;
 
+		LriArenaFree();
+
 		free(gpObjects);
 		gpObjects = 0;
 	}
@@ -1532,6 +1544,9 @@ void main (int argc, char *argv[])
 		pIntrsctnPool,
 		sizeOfIntrsctnPool
 		);
+
+	if ( gRouteHierarchy )
+		BuildRouteHierarchy();
 #if 0
 	// these are the test codes only for highway.lri
 	DisplayIntrsctn(pCharPool, pIntrsctnPool, sizeOfIntrsctnPool, pObjRefPool);
@@ -1557,6 +1572,8 @@ void main (int argc, char *argv[])
 #endif
 
 	WriteOutputFile(binLRI, postPool, elevMapPool);
+	if ( gIncremental )
+		SaveArtifactCache(cacheFile);
 	printf(" Binary LRI generation completed successfully.\n");
 	exit(0);
 }
@@ -50,6 +50,10 @@ void DumpCharPool(const char *, int size);
 void DumpObjPool(const cvTObj *, int);
 void DumpObjAttrPool(const cvTObjAttr *, int);
 
+void *LriArenaAlloc(size_t);
+char *LriInternString(const char *);
+void  LriArenaFree(void);
+
 /***************************************************************************
  *
  * Information about the header of the LRI file
@@ -542,6 +546,10 @@ extern cvTIntrsctnRef	*pIntrsctnRefPool;
 extern int				sizeOfIntrsctnRefPool;
 extern cvTCrdrMrgDst	*pCrdrMrgDstPool;
 extern int				sizeOfCrdrMrgDstPool;
+extern cvTRouteHierNode	*pRouteHierNodePool;
+extern int				sizeOfRouteHierNodePool;
+extern cvTRouteHierEdge	*pRouteHierEdgePool;
+extern int				sizeOfRouteHierEdgePool;
 
 
 
@@ -556,6 +564,8 @@ extern int         gOvrdVersionMin;
 extern int         gOvrdVersion1;
 extern int         gOvrdVersion2;
 extern int         gOvrdVersion3;
+extern int         gIncremental;
+extern int         gRouteHierarchy;
 
 
 extern TLatCurve	*gpLatCurves;
@@ -583,6 +593,12 @@ void GenerateObjects(
 			int, 
 			cvTObj**, 
 			int *);
+unsigned int HashArtifactData(const void *, size_t, unsigned int);
+bool GetCachedArtifact(const char *, unsigned int, void *, size_t);
+void PutCachedArtifact(const char *, unsigned int, const void *, size_t);
+void LoadArtifactCache(const char *);
+void SaveArtifactCache(const char *);
+void BuildRouteHierarchy(void);
 
 
 
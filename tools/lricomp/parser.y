@@ -271,7 +271,7 @@ lateral_curve_def	:
 		lateral_curve_def LRI_IDENTIFIER LRI_CURLY_OPEN curve_def 
 				LRI_CURLY_CLOSE
 		{
-			TLatCurve* pTemp = calloc(1, sizeof(TLatCurve));
+			TLatCurve* pTemp = LriArenaAlloc(sizeof(TLatCurve));
 
 			*pTemp = $4;
 			strncpy (pTemp->curveName, $2, cMAX_WORDLENGTH);
@@ -281,7 +281,7 @@ lateral_curve_def	:
 
 	| 	LRI_IDENTIFIER LRI_CURLY_OPEN curve_def LRI_CURLY_CLOSE
 		{
-			TLatCurve* pTemp = calloc(1, sizeof(TLatCurve));
+			TLatCurve* pTemp = LriArenaAlloc(sizeof(TLatCurve));
 
 			*pTemp = $3;
 			strncpy (pTemp->curveName, $1, cMAX_WORDLENGTH);
@@ -302,7 +302,7 @@ curve_def	:
 			/* to flip its direction */
 
 			for ( pT = $2; pT; pT = pT->pNext ) {
-				TCurveDef *pNew = calloc(1, sizeof(TLatCurve));
+				TCurveDef *pNew = LriArenaAlloc(sizeof(TLatCurve));
 
 				*pNew = *pT;
 				pNew->pNext = pHead;
@@ -317,7 +317,7 @@ curve_def	:
 lat_cpoints_def	: 
 		lat_cpoints_def lat_cpoint lat_cpoint
 		{
-            TCurveDef* pTemp 	  = calloc(1, sizeof(TCurveDef));
+            TCurveDef* pTemp 	  = LriArenaAlloc(sizeof(TCurveDef));
             pTemp->latCpoint1 	  = $2;
             pTemp->latCpoint2 	  = $3;
             pTemp->pNext          = $$;
@@ -326,7 +326,7 @@ lat_cpoints_def	:
 
     	| lat_cpoint lat_cpoint
         {
-            TCurveDef* pTemp= calloc(1, sizeof(TCurveDef));
+            TCurveDef* pTemp= LriArenaAlloc(sizeof(TCurveDef));
             pTemp->latCpoint1 = $1;
             pTemp->latCpoint2 = $2;
             $$ = pTemp;
@@ -353,7 +353,7 @@ road_def_list	:
                 LRI_LONGCURVE LRI_CURLY_OPEN control_points LRI_CURLY_CLOSE 
 				LRI_CURLY_CLOSE
 		{
-			TRoads* p = calloc(1, sizeof(TRoads));
+			TRoads* p = LriArenaAlloc(sizeof(TRoads));
 
 			strncpy(p->roadName, $2, cMAX_WORDLENGTH);
 			strncpy(p->intersection1, $3, cMAX_WORDLENGTH);
@@ -372,7 +372,7 @@ road_def_list	:
       		LRI_LONGCURVE LRI_CURLY_OPEN control_points  LRI_CURLY_CLOSE 
 			LRI_CURLY_CLOSE
 		{
-			TRoads* p = calloc(1, sizeof(TRoads));
+			TRoads* p = LriArenaAlloc(sizeof(TRoads));
 
 			strncpy(p->roadName, $1, cMAX_WORDLENGTH);
 			strncpy(p->intersection1, $2, cMAX_WORDLENGTH);
@@ -419,7 +419,7 @@ rep_obj_list :
 rep_obj:
 		LRI_IDENTIFIER LRI_REAL LRI_REAL LRI_REAL LRI_REAL
 		{
-			TRepObj *pTem = calloc(1, sizeof(TRepObj));
+			TRepObj *pTem = LriArenaAlloc(sizeof(TRepObj));
 
 			strcpy(pTem->name, $1);
 			pTem->latdist  = $2;
@@ -433,7 +433,7 @@ rep_obj:
 		|
 		LRI_IDENTIFIER LRI_REAL LRI_REAL LRI_REAL LRI_REAL LRI_ALIGNED
 		{
-			TRepObj *pTem = calloc(1, sizeof(TRepObj));
+			TRepObj *pTem = LriArenaAlloc(sizeof(TRepObj));
 
 			strcpy(pTem->name, $1);
 			pTem->latdist  = $2;
@@ -464,7 +464,7 @@ road_attributes	:
 attribute_def	: 
 		attribute_def attribute
 		{
-			TAttribute* pAttr = calloc(1, sizeof(TAttribute));
+			TAttribute* pAttr = LriArenaAlloc(sizeof(TAttribute));
 			*pAttr = $2;
 			pAttr->pNext = $$;
 			$$ = pAttr;
@@ -472,7 +472,7 @@ attribute_def	:
 
 		| attribute
 		{
-			TAttribute* pAttr = calloc(1, sizeof(TAttribute));
+			TAttribute* pAttr = LriArenaAlloc(sizeof(TAttribute));
             *pAttr = $1;
 			$$ = pAttr;
 		}
@@ -600,7 +600,7 @@ control_point	:
 cpoint_infolist	: 
 		cpoint_infolist cpoint_info
 		{
-			TCpointInfo* pCP = calloc(1, sizeof(TCpointInfo));
+			TCpointInfo* pCP = LriArenaAlloc(sizeof(TCpointInfo));
 
 			*pCP = $2;
 			pCP->pNext = $$;
@@ -609,7 +609,7 @@ cpoint_infolist	:
 
 		| cpoint_info
 		{
-			TCpointInfo* pCP = calloc(1, sizeof(TCpointInfo));
+			TCpointInfo* pCP = LriArenaAlloc(sizeof(TCpointInfo));
 
 			*pCP = $1;
 			$$ = pCP;
@@ -717,7 +717,7 @@ elev_map	:
 		LRI_ELEVMAP LRI_IDENTIFIER LRI_REAL LRI_REAL LRI_REAL LRI_CURLY_OPEN 
 				elev_map_part LRI_CURLY_CLOSE
 		{
-			$$ = calloc(1, sizeof(TElevMap));
+			$$ = LriArenaAlloc(sizeof(TElevMap));
 			strncpy ($$->elevMapName, $2, cMAX_WORDLENGTH);
 			$$->n_rows 		= (int)$3;
 			$$->n_cols 		= (int)$4;
@@ -733,7 +733,7 @@ elev_map	:
 elev_map_part	: 
 		elev_map_part LRI_REAL LRI_REAL
 		{
-			TElevMap2* pTemp	 = malloc(sizeof(TElevMap2));
+			TElevMap2* pTemp	 = LriArenaAlloc(sizeof(TElevMap2));
 
 			/* add to end of list; list contains at least one item */
 			/* we add to the tail of the list because order
@@ -752,8 +752,8 @@ elev_map_part	:
 	
 		| LRI_REAL LRI_REAL
 		{
-			TElevMap2ListInfo* pElevMapListInfo = malloc(sizeof(TElevMap2ListInfo));
-			TElevMap2* pTemp	 = malloc(sizeof(TElevMap2));
+			TElevMap2ListInfo* pElevMapListInfo = LriArenaAlloc(sizeof(TElevMap2ListInfo));
+			TElevMap2* pTemp	 = LriArenaAlloc(sizeof(TElevMap2));
 			pTemp->z 			 = $1;
 			pTemp->materialRef	 = (int)$2;
 			pTemp->pNextElevMap2 = NULL;
@@ -784,7 +784,7 @@ intersec :
 		LRI_IDENTIFIER  elev_info LRI_CURLY_OPEN LRI_ROADS road_names  
 				border_def crdr_list inter_attr_spec LRI_CURLY_CLOSE
 		{
-			$$ = calloc(1, sizeof(TIntersection));
+			$$ = LriArenaAlloc(sizeof(TIntersection));
 
 			strncpy($$->name, $1, cMAX_WORDLENGTH);
 			$$->elevInfo 		  = $2;
@@ -797,7 +797,7 @@ intersec :
 		| LRI_IDENTIFIER  elev_info LRI_CURLY_OPEN 
 				border_def crdr_list inter_attr_spec LRI_CURLY_CLOSE
 		{
-			$$ = calloc(1, sizeof(TIntersection));
+			$$ = LriArenaAlloc(sizeof(TIntersection));
 
 			strncpy($$->name, $1, cMAX_WORDLENGTH);
 			$$->elevInfo 		  = $2;
@@ -826,7 +826,7 @@ intersec :
 road_names	: 
 		road_names LRI_IDENTIFIER
 		{
-			TRoadName* pTemp = malloc(sizeof(TRoadName));
+			TRoadName* pTemp = LriArenaAlloc(sizeof(TRoadName));
 
 			strncpy (pTemp->roadName, $2, cMAX_WORDLENGTH);
 			pTemp->pNextRoadName = $$;
@@ -835,7 +835,7 @@ road_names	:
 
 		| LRI_IDENTIFIER
 		{
-			TRoadName* pTemp = calloc(1, sizeof(TRoadName));
+			TRoadName* pTemp = LriArenaAlloc(sizeof(TRoadName));
 
 			strncpy (pTemp->roadName, $1, cMAX_WORDLENGTH);
 			$$ = pTemp;
@@ -876,7 +876,7 @@ inter_attr_spec	:
 inter_attr_list	: 
 		inter_attr_list inter_attr
 		{
-			TAttribute *pNew = malloc(sizeof(TAttribute));
+			TAttribute *pNew = LriArenaAlloc(sizeof(TAttribute));
 
 			*pNew = $2;
 			pNew->pNext = $$;
@@ -886,7 +886,7 @@ inter_attr_list	:
 		|
 		inter_attr
 		{
-			$$ = malloc(sizeof(TAttribute));
+			$$ = LriArenaAlloc(sizeof(TAttribute));
 			*$$ = $1;
 		}
 		;
@@ -956,7 +956,7 @@ border_pt :
 crdr_list :
 			crdr_list crdr
 		{
-			TCrdr *pC = malloc(sizeof(*pC));
+			TCrdr *pC = LriArenaAlloc(sizeof(*pC));
 
 			*pC = $2;
 			pC->pNext = $$;
@@ -965,7 +965,7 @@ crdr_list :
 
 		|	crdr
 		{
-			TCrdr *pC = calloc(1, sizeof(*pC));
+			TCrdr *pC = LriArenaAlloc(sizeof(*pC));
 
 			*pC = $1;
 			$$ =  pC;
@@ -1013,7 +1013,7 @@ crdr :
 hold_ofs_list : 
 		hold_ofs_list hold_ofs
 		{
-			THoldOfs *pH = malloc(sizeof(*pH));
+			THoldOfs *pH = LriArenaAlloc(sizeof(*pH));
 
 			*pH = $2;
 			pH->pNextHoldOfs = $$;
@@ -1022,7 +1022,7 @@ hold_ofs_list :
 
 		|  hold_ofs
 		{
-			THoldOfs *pH = calloc(1, sizeof(*pH));
+			THoldOfs *pH = LriArenaAlloc(sizeof(*pH));
 
 			*pH = $1;
 			$$ =  pH;
@@ -1120,7 +1120,7 @@ crdr_curve_point	:
 crdr_line_info	: 
 		LRI_LINES LRI_LFLAG LRI_LSTYLE LRI_LFLAG LRI_LSTYLE
 		{
-			$$ = calloc(1, sizeof(TCrdrLineInfo));
+			$$ = LriArenaAlloc(sizeof(TCrdrLineInfo));
 			$$->lflag1 = $2;
 			strncpy ($$->lstyle1, $3, cMAX_WORDLENGTH);
 			$$->lflag2 = $4;
@@ -1150,7 +1150,7 @@ crdr_attr_spec	:
 crdr_attr_list:
 		crdr_attr_list crdr_attr
 		{
-			TAttribute *pNew = malloc(sizeof(TAttribute));
+			TAttribute *pNew = LriArenaAlloc(sizeof(TAttribute));
 
 			*pNew = $2;
 			pNew->pNext = $$;
@@ -1160,7 +1160,7 @@ crdr_attr_list:
 		|
 		crdr_attr
 		{
-			$$ = malloc(sizeof(TAttribute));
+			$$ = LriArenaAlloc(sizeof(TAttribute));
 
 			*$$ = $1;
 		}
@@ -0,0 +1,503 @@
+/***************************************************************************
+ * (C) Copyright 1998 by NADS & Simulation Center The University of Iowa
+ * and The University of Iowa.  All rights reserved.
+ *
+ * $Id: routehier.cxx,v 1.1 $
+ *
+ * Author(s) :
+ * Date:
+ *
+ * Description:
+ * This file contains the code that builds the route hierarchy stored in
+ * the binary lri file when the compiler is run with the -routes option.
+ * The road network is seen as a directed graph whose nodes are roads
+ * traveled in one direction and whose edges are the driving corridors,
+ * exactly as in the graph CVED builds for route planning.  The nodes are
+ * contracted one at a time, from the least to the most important, and a
+ * shortcut edge is added between two neighbors of a contracted node
+ * whenever the only shortest path between them goes through that node.
+ * At run time, a shortest route search only has to follow edges leading
+ * to more important nodes, from both ends of the route, which visits a
+ * small fraction of the network even for very long routes.
+ *
+ **************************************************************************/
+#ifdef _WIN32
+#include <ostream>
+#include <iostream>
+#elif __sgi
+#include <typeinfo>
+#include <iostream.h>
+#endif
+
+#include <vector>
+#include <queue>
+#include <functional>
+
+using namespace std;
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include "parser.h"
+#include "err.h"
+
+/*
+ * limits the number of nodes settled by a witness search; when the limit
+ * is reached the shortcut is added, which is never wrong, only redundant
+ */
+#define cMAX_WITNESS_SETTLED   500
+
+/*
+ * an edge of the graph being contracted
+ */
+typedef struct TArc {
+	int		node;		/* node at the other end */
+	int		middle;		/* node bypassed by a shortcut, -1 for a corridor */
+	int		crdrId;		/* relative corridor id, -1 for a shortcut */
+	double	length;
+} TArc;
+
+typedef vector<TArc> TArcVec;
+
+static vector<TArcVec>	sOutArcs;	/* arcs leaving each remaining node */
+static vector<TArcVec>	sInArcs;	/* arcs reaching each remaining node */
+static vector<double>	sWitnessDist;
+static vector<int>		sWitnessTouched;
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: IsDrivingLane
+ *
+ *	This function indicates if cars can drive on a lane, using the same
+ *	rules as CLane::IsDrivingLane: the lane must not be tagged as a
+ *	vehicle restriction lane or a turn lane, either by an attribute of its
+ *	road that covers the lane or by an attribute of the lane itself.
+ *
+ *	Input:
+ *		pLane:	the lane
+ *
+ *	Return Value:
+ *		true if the lane is a driving lane, false otherwise
+ *
+ *---------------------------------------------------------------------------*/
+static bool IsDrivingLane(const cvTLane* pLane)
+{
+	const cvTRoad*	pRoad    = pRoadPool + pLane->roadId;
+	int				laneMask = 1 << (pLane->laneNo % cCV_MAX_LANES);
+	int				i;
+
+	for ( i = 0; i < pRoad->numAttr; i++ ) {
+		const cvTAttr* pAttr = pAttrPool + pRoad->attrIdx + i;
+
+		if ( pAttr->myId == 0 ) continue;
+		if ( ( pAttr->myId == cCV_VEHICLE_RESTRICTION_LANE_ATTR ||
+			   pAttr->myId == cCV_TURN_LANE_ATTR ) &&
+			 ( pAttr->laneMask & laneMask ) )
+			return false;
+	}
+
+	for ( i = 0; i < pLane->numAttr; i++ ) {
+		const cvTAttr* pAttr = pAttrPool + pLane->attrIdx + i;
+
+		if ( pAttr->myId == cCV_VEHICLE_RESTRICTION_LANE_ATTR ||
+			 pAttr->myId == cCV_TURN_LANE_ATTR )
+			return false;
+	}
+
+	return true;
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: AddArc
+ *
+ *	NON-REENTRANT
+ *
+ *	This function adds an arc between two remaining nodes.  If the nodes
+ *	are already connected, only the shorter of the two arcs is kept.
+ *	Arcs from a node to itself are never part of a shortest route and are
+ *	ignored.
+ *
+ *	Input:
+ *		from:	source node
+ *		arc:	the arc, whose node field is the target node
+ *
+ *---------------------------------------------------------------------------*/
+static void AddArc(int from, const TArc& arc)
+{
+	TArcVec::iterator itr;
+
+	if ( from == arc.node ) return;
+
+	for ( itr = sOutArcs[from].begin(); itr != sOutArcs[from].end(); itr++ ) {
+		if ( itr->node == arc.node ) {
+			if ( arc.length < itr->length ) {
+				TArcVec::iterator inItr;
+
+				*itr = arc;
+				for ( inItr = sInArcs[arc.node].begin();
+						inItr != sInArcs[arc.node].end(); inItr++ ) {
+					if ( inItr->node == from ) {
+						*inItr = arc;
+						inItr->node = from;
+						break;
+					}
+				}
+			}
+			return;
+		}
+	}
+
+	TArc inArc = arc;
+
+	inArc.node = from;
+	sOutArcs[from].push_back(arc);
+	sInArcs[arc.node].push_back(inArc);
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: RemoveArc
+ *
+ *	This function removes the arc leading to a node from a list of arcs.
+ *
+ *---------------------------------------------------------------------------*/
+static void RemoveArc(TArcVec& arcs, int node)
+{
+	TArcVec::iterator itr;
+
+	for ( itr = arcs.begin(); itr != arcs.end(); itr++ ) {
+		if ( itr->node == node ) {
+			arcs.erase(itr);
+			return;
+		}
+	}
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: WitnessSearch
+ *
+ *	NON-REENTRANT
+ *
+ *	This function computes the length of the shortest paths leaving a node
+ *	that do not go through the node being contracted, stopping at the
+ *	specified length.  The lengths are left in sWitnessDist; nodes that
+ *	were not reached have a length of DBL_MAX.
+ *
+ *	Input:
+ *		src:		the source node
+ *		skip:		the node being contracted
+ *		maxLength:	length beyond which paths are of no interest
+ *
+ *---------------------------------------------------------------------------*/
+static void WitnessSearch(int src, int skip, double maxLength)
+{
+	typedef pair<double, int> TQueueItem;
+
+	priority_queue<TQueueItem, vector<TQueueItem>, greater<TQueueItem> > open;
+	vector<int>::iterator  tItr;
+	int                    numSettled = 0;
+
+	for ( tItr = sWitnessTouched.begin(); tItr != sWitnessTouched.end(); tItr++ )
+		sWitnessDist[*tItr] = DBL_MAX;
+	sWitnessTouched.clear();
+
+	sWitnessDist[src] = 0.0;
+	sWitnessTouched.push_back(src);
+	open.push(TQueueItem(0.0, src));
+
+	while ( !open.empty() ) {
+		TQueueItem item = open.top();
+		open.pop();
+
+		if ( item.first > sWitnessDist[item.second] ) continue;
+		if ( item.first > maxLength ) break;
+		if ( ++numSettled > cMAX_WITNESS_SETTLED ) break;
+
+		TArcVec::const_iterator itr;
+		const TArcVec& arcs = sOutArcs[item.second];
+		for ( itr = arcs.begin(); itr != arcs.end(); itr++ ) {
+			double length = item.first + itr->length;
+
+			if ( itr->node == skip ) continue;
+			if ( length < sWitnessDist[itr->node] ) {
+				if ( sWitnessDist[itr->node] == DBL_MAX )
+					sWitnessTouched.push_back(itr->node);
+				sWitnessDist[itr->node] = length;
+				open.push(TQueueItem(length, itr->node));
+			}
+		}
+	}
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: ContractNode
+ *
+ *	NON-REENTRANT
+ *
+ *	This function finds the shortcuts needed to remove a node from the
+ *	graph.  When simulate is false, the shortcuts are added and the node
+ *	is removed from the lists of its neighbors; otherwise the graph is
+ *	left untouched and only the number of shortcuts is computed, which
+ *	is used to decide the order in which nodes are contracted.
+ *
+ *	Input:
+ *		node:		the node to contract
+ *		simulate:	true to only count the shortcuts
+ *
+ *	Return Value:
+ *		the number of shortcuts needed
+ *
+ *---------------------------------------------------------------------------*/
+static int ContractNode(int node, bool simulate)
+{
+	TArcVec  inArcs  = sInArcs[node];
+	TArcVec  outArcs = sOutArcs[node];
+	int      numShortcuts = 0;
+	TArcVec::const_iterator inItr, outItr;
+
+	if ( !simulate ) {
+		for ( inItr = inArcs.begin(); inItr != inArcs.end(); inItr++ )
+			RemoveArc(sOutArcs[inItr->node], node);
+		for ( outItr = outArcs.begin(); outItr != outArcs.end(); outItr++ )
+			RemoveArc(sInArcs[outItr->node], node);
+	}
+
+	if ( outArcs.empty() ) return 0;
+
+	for ( inItr = inArcs.begin(); inItr != inArcs.end(); inItr++ ) {
+		double maxLength = 0.0;
+
+		for ( outItr = outArcs.begin(); outItr != outArcs.end(); outItr++ ) {
+			if ( inItr->length + outItr->length > maxLength )
+				maxLength = inItr->length + outItr->length;
+		}
+
+		WitnessSearch(inItr->node, node, maxLength);
+
+		for ( outItr = outArcs.begin(); outItr != outArcs.end(); outItr++ ) {
+			double length = inItr->length + outItr->length;
+
+			if ( outItr->node == inItr->node ) continue;
+			if ( sWitnessDist[outItr->node] <= length ) continue;
+
+			numShortcuts++;
+			if ( !simulate ) {
+				TArc shortcut;
+
+				shortcut.node   = outItr->node;
+				shortcut.middle = node;
+				shortcut.crdrId = -1;
+				shortcut.length = length;
+				AddArc(inItr->node, shortcut);
+			}
+		}
+	}
+
+	return numShortcuts;
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: GetPriority
+ *
+ *	NON-REENTRANT
+ *
+ *	This function computes the priority of a remaining node; nodes with
+ *	a lower priority are contracted first.  The priority is the number of
+ *	shortcuts the contraction would add minus the number of arcs it would
+ *	remove, plus the number of neighbors already contracted so that the
+ *	contractions are spread evenly over the network.
+ *
+ *---------------------------------------------------------------------------*/
+static int GetPriority(int node, const vector<int>& numContractedNbrs)
+{
+	int numArcs = (int)(sInArcs[node].size() + sOutArcs[node].size());
+
+	return ContractNode(node, true) - numArcs + numContractedNbrs[node];
+}
+
+
+/*---------------------------------------------------------------------------*
+ *
+ *	Name: BuildRouteHierarchy
+ *
+ *	NON-REENTRANT
+ *
+ *	This function builds the route hierarchy from the road, intersection,
+ *	corridor, lane and attribute pools and stores it in the route
+ *	hierarchy node and edge pools.  The length of an edge is the linear
+ *	length of its source road plus the length of the corridor, so it must
+ *	be called after the geometry of roads and corridors has been computed.
+ *	Only attributes present in the lri file are taken into account; lanes
+ *	whose attributes are changed at run time are not reflected.
+ *
+ *---------------------------------------------------------------------------*/
+void BuildRouteHierarchy(void)
+{
+	int numNodes = 2 * sizeOfRoadPool;
+	int rId;
+	int node;
+
+	sOutArcs.assign(numNodes, TArcVec());
+	sInArcs.assign(numNodes, TArcVec());
+	sWitnessDist.assign(numNodes, DBL_MAX);
+	sWitnessTouched.clear();
+
+	/*
+	 * build the graph; a road traveled in the positive direction leads
+	 * to its destination intersection, otherwise to its source
+	 */
+	for ( rId = 1; rId < sizeOfRoadPool; rId++ ) {
+		const cvTRoad* pRoad = pRoadPool + rId;
+		int            dir;
+
+		if ( pRoad->numCntrlPnt < 1 ) continue;
+
+		for ( dir = 0; dir < 2; dir++ ) {
+			int iId = (dir == 0) ? pRoad->dstIntrsctnIdx : pRoad->srcIntrsctnIdx;
+			const cvTIntrsctn* pInt;
+			unsigned int       c;
+
+			if ( iId <= 0 || iId >= sizeOfIntrsctnPool ) continue;
+			pInt = pIntrsctnPool + iId;
+
+			for ( c = 0; c < pInt->numOfCrdrs; c++ ) {
+				const cvTCrdr* pCrdr = pCrdrPool + pInt->crdrIdx + c;
+				const cvTLane* pDstLane;
+				const cvTCrdrCntrlPnt* pLast;
+				TArc           arc;
+
+				if ( pCrdr->srcRdIdx != rId ) continue;
+				if ( !IsDrivingLane(pLanePool + pCrdr->srcLnIdx) ) continue;
+
+				pDstLane = pLanePool + pCrdr->dstLnIdx;
+				pLast    = pCrdrCntrlPntPool + pCrdr->cntrlPntIdx +
+								pCrdr->numCntrlPnt - 1;
+
+				arc.node   = 2 * pCrdr->dstRdIdx +
+								(pDstLane->direction == ePOS ? 0 : 1);
+				arc.middle = -1;
+				arc.crdrId = c;
+				arc.length = pRoad->roadLengthLinear + pLast->distance;
+				AddArc(2 * rId + dir, arc);
+			}
+		}
+	}
+
+	/*
+	 * contract the nodes in order of priority; the priority of a node
+	 * may have increased since it was queued, in which case it is queued
+	 * again instead of being contracted
+	 */
+	typedef pair<int, int> TQueueItem;		/* priority, node */
+
+	priority_queue<TQueueItem, vector<TQueueItem>, greater<TQueueItem> > queue;
+	vector<int>  numContractedNbrs(numNodes, 0);
+	vector<int>  rank(numNodes, -1);
+	vector<TArcVec> upArcs(numNodes);
+	vector<TArcVec> downArcs(numNodes);
+	int          nextRank = 0;
+	int          numShortcuts = 0;
+
+	for ( node = 0; node < numNodes; node++ )
+		queue.push(TQueueItem(GetPriority(node, numContractedNbrs), node));
+
+	while ( !queue.empty() ) {
+		TQueueItem item = queue.top();
+		queue.pop();
+
+		node = item.second;
+		if ( rank[node] >= 0 ) continue;
+
+		int priority = GetPriority(node, numContractedNbrs);
+		if ( !queue.empty() && priority > queue.top().first ) {
+			queue.push(TQueueItem(priority, node));
+			continue;
+		}
+
+		/*
+		 * the remaining neighbors all get a higher rank, so the arcs of
+		 * the node are final
+		 */
+		TArcVec::const_iterator itr;
+		upArcs[node]   = sOutArcs[node];
+		downArcs[node] = sInArcs[node];
+		for ( itr = upArcs[node].begin(); itr != upArcs[node].end(); itr++ )
+			numContractedNbrs[itr->node]++;
+		for ( itr = downArcs[node].begin(); itr != downArcs[node].end(); itr++ )
+			numContractedNbrs[itr->node]++;
+
+		rank[node] = nextRank++;
+		numShortcuts += ContractNode(node, false);
+		sOutArcs[node].clear();
+		sInArcs[node].clear();
+	}
+
+	/*
+	 * store the hierarchy; the upward edges of all nodes come first,
+	 * followed by the downward edges
+	 */
+	int numUp = 0;
+	int numDown = 0;
+
+	for ( node = 0; node < numNodes; node++ ) {
+		numUp   += (int)upArcs[node].size();
+		numDown += (int)downArcs[node].size();
+	}
+
+	sizeOfRouteHierNodePool = numNodes + 1;
+	sizeOfRouteHierEdgePool = numUp + numDown;
+	pRouteHierNodePool = (cvTRouteHierNode *)calloc(
+							sizeOfRouteHierNodePool, sizeof(cvTRouteHierNode));
+	pRouteHierEdgePool = (cvTRouteHierEdge *)calloc(
+							sizeOfRouteHierEdgePool + 1, sizeof(cvTRouteHierEdge));
+	if ( pRouteHierNodePool == NULL || pRouteHierEdgePool == NULL ) {
+		lrierr(eROUTE_HIER_POOL_ALLOC_FAIL, "");
+		exit(1);
+	}
+
+	int upIdx   = 0;
+	int downIdx = numUp;
+
+	for ( node = 0; node <= numNodes; node++ ) {
+		cvTRouteHierNode* pNode = pRouteHierNodePool + node;
+
+		pNode->rank          = (node < numNodes) ? rank[node] : nextRank;
+		pNode->firstUpEdge   = upIdx;
+		pNode->firstDownEdge = downIdx;
+		if ( node == numNodes ) break;
+
+		for ( int pass = 0; pass < 2; pass++ ) {
+			const TArcVec& arcs = (pass == 0) ? upArcs[node] : downArcs[node];
+			int&           idx  = (pass == 0) ? upIdx : downIdx;
+			TArcVec::const_iterator itr;
+
+			for ( itr = arcs.begin(); itr != arcs.end(); itr++, idx++ ) {
+				cvTRouteHierEdge* pEdge = pRouteHierEdgePool + idx;
+
+				pEdge->node   = itr->node;
+				pEdge->middle = itr->middle;
+				pEdge->crdrId = itr->crdrId;
+				pEdge->length = itr->length;
+			}
+		}
+	}
+
+	sOutArcs.clear();
+	sInArcs.clear();
+	sWitnessDist.clear();
+	sWitnessTouched.clear();
+
+	printf(" Route hierarchy has %d nodes, %d edges and %d shortcuts.\n",
+			numNodes, sizeOfRouteHierEdgePool, numShortcuts);
+}
@@ -1315,7 +1315,7 @@ case 16:
 case 17:
 #line 273 "parser.y"
 {
-			TLatCurve* pTemp = calloc(1, sizeof(TLatCurve));
+			TLatCurve* pTemp = LriArenaAlloc(sizeof(TLatCurve));
 
 			*pTemp = yyvsp[-1].latcurvedef;
 			strncpy (pTemp->curveName, yyvsp[-3].strval, cMAX_WORDLENGTH);
@@ -1326,7 +1326,7 @@ case 17:
 case 18:
 #line 283 "parser.y"
 {
-			TLatCurve* pTemp = calloc(1, sizeof(TLatCurve));
+			TLatCurve* pTemp = LriArenaAlloc(sizeof(TLatCurve));
 
 			*pTemp = yyvsp[-1].latcurvedef;
 			strncpy (pTemp->curveName, yyvsp[-3].strval, cMAX_WORDLENGTH);
@@ -1344,7 +1344,7 @@ case 19:
 			/* to flip its direction */
 
 			for ( pT = yyvsp[0].curvedefptr; pT; pT = pT->pNext ) {
-				TCurveDef *pNew = calloc(1, sizeof(TLatCurve));
+				TCurveDef *pNew = LriArenaAlloc(sizeof(TLatCurve));
 
 				*pNew = *pT;
 				pNew->pNext = pHead;
@@ -1356,7 +1356,7 @@ case 19:
 case 20:
 #line 319 "parser.y"
 {
-            TCurveDef* pTemp 	  = calloc(1, sizeof(TCurveDef));
+            TCurveDef* pTemp 	  = LriArenaAlloc(sizeof(TCurveDef));
             pTemp->latCpoint1 	  = yyvsp[-1].latcpointdef;
             pTemp->latCpoint2 	  = yyvsp[0].latcpointdef;
             pTemp->pNext          = yyval.curvedefptr;
@@ -1366,7 +1366,7 @@ case 20:
 case 21:
 #line 328 "parser.y"
 {
-            TCurveDef* pTemp= calloc(1, sizeof(TCurveDef));
+            TCurveDef* pTemp= LriArenaAlloc(sizeof(TCurveDef));
             pTemp->latCpoint1 = yyvsp[-1].latcpointdef;
             pTemp->latCpoint2 = yyvsp[0].latcpointdef;
             yyval.curvedefptr = pTemp;
@@ -1383,7 +1383,7 @@ case 22:
 case 23:
 #line 355 "parser.y"
 {
-			TRoads* p = calloc(1, sizeof(TRoads));
+			TRoads* p = LriArenaAlloc(sizeof(TRoads));
 
 			strncpy(p->roadName, yyvsp[-14].strval, cMAX_WORDLENGTH);
 			strncpy(p->intersection1, yyvsp[-13].strval, cMAX_WORDLENGTH);
@@ -1399,7 +1399,7 @@ case 23:
 case 24:
 #line 374 "parser.y"
 {
-			TRoads* p = calloc(1, sizeof(TRoads));
+			TRoads* p = LriArenaAlloc(sizeof(TRoads));
 
 			strncpy(p->roadName, yyvsp[-14].strval, cMAX_WORDLENGTH);
 			strncpy(p->intersection1, yyvsp[-13].strval, cMAX_WORDLENGTH);
@@ -1441,7 +1441,7 @@ case 28:
 case 29:
 #line 421 "parser.y"
 {
-			TRepObj *pTem = calloc(1, sizeof(TRepObj));
+			TRepObj *pTem = LriArenaAlloc(sizeof(TRepObj));
 
 			strcpy(pTem->name, yyvsp[-4].strval);
 			pTem->latdist  = yyvsp[-3].dval;
@@ -1455,7 +1455,7 @@ case 29:
 case 30:
 #line 435 "parser.y"
 {
-			TRepObj *pTem = calloc(1, sizeof(TRepObj));
+			TRepObj *pTem = LriArenaAlloc(sizeof(TRepObj));
 
 			strcpy(pTem->name, yyvsp[-5].strval);
 			pTem->latdist  = yyvsp[-4].dval;
@@ -1481,7 +1481,7 @@ case 32:
 case 33:
 #line 466 "parser.y"
 {
-			TAttribute* pAttr = calloc(1, sizeof(TAttribute));
+			TAttribute* pAttr = LriArenaAlloc(sizeof(TAttribute));
 			*pAttr = yyvsp[0].attributedef;
 			pAttr->pNext = yyval.attributeptr;
 			yyval.attributeptr = pAttr;
@@ -1490,7 +1490,7 @@ case 33:
 case 34:
 #line 474 "parser.y"
 {
-			TAttribute* pAttr = calloc(1, sizeof(TAttribute));
+			TAttribute* pAttr = LriArenaAlloc(sizeof(TAttribute));
             *pAttr = yyvsp[0].attributedef;
 			yyval.attributeptr = pAttr;
 		}
@@ -1602,7 +1602,7 @@ case 43:
 case 44:
 #line 602 "parser.y"
 {
-			TCpointInfo* pCP = calloc(1, sizeof(TCpointInfo));
+			TCpointInfo* pCP = LriArenaAlloc(sizeof(TCpointInfo));
 
 			*pCP = yyvsp[0].cpointinfodef;
 			pCP->pNext = yyval.cpointinfoptr;
@@ -1612,7 +1612,7 @@ case 44:
 case 45:
 #line 611 "parser.y"
 {
-			TCpointInfo* pCP = calloc(1, sizeof(TCpointInfo));
+			TCpointInfo* pCP = LriArenaAlloc(sizeof(TCpointInfo));
 
 			*pCP = yyvsp[0].cpointinfodef;
 			yyval.cpointinfoptr = pCP;
@@ -1709,7 +1709,7 @@ case 58:
 case 59:
 #line 719 "parser.y"
 {
-			yyval.elevmapptr = calloc(1, sizeof(TElevMap));
+			yyval.elevmapptr = LriArenaAlloc(sizeof(TElevMap));
 			strncpy (yyval.elevmapptr->elevMapName, yyvsp[-6].strval, cMAX_WORDLENGTH);
 			yyval.elevmapptr->n_rows 		= (int)yyvsp[-5].dval;
 			yyval.elevmapptr->n_cols 		= (int)yyvsp[-4].dval;
@@ -1722,7 +1722,7 @@ case 59:
 case 60:
 #line 734 "parser.y"
 {
-			TElevMap2* pTemp	 = malloc(sizeof(TElevMap2));
+			TElevMap2* pTemp	 = LriArenaAlloc(sizeof(TElevMap2));
 
 			/* add to end of list; list contains at least one item */
 			/* we add to the tail of the list because order
@@ -1742,8 +1742,8 @@ case 60:
 case 61:
 #line 754 "parser.y"
 {
-			TElevMap2ListInfo* pElevMapListInfo = malloc(sizeof(TElevMap2ListInfo));
-			TElevMap2* pTemp	 = malloc(sizeof(TElevMap2));
+			TElevMap2ListInfo* pElevMapListInfo = LriArenaAlloc(sizeof(TElevMap2ListInfo));
+			TElevMap2* pTemp	 = LriArenaAlloc(sizeof(TElevMap2));
 			pTemp->z 			 = yyvsp[-1].dval;
 			pTemp->materialRef	 = (int)yyvsp[0].dval;
 			pTemp->pNextElevMap2 = NULL;
@@ -1768,7 +1768,7 @@ case 63:
 case 64:
 #line 783 "parser.y"
 {
-			yyval.intersectionsptr = calloc(1, sizeof(TIntersection));
+			yyval.intersectionsptr = LriArenaAlloc(sizeof(TIntersection));
 
 			strncpy(yyval.intersectionsptr->name, yyvsp[-8].strval, cMAX_WORDLENGTH);
 			yyval.intersectionsptr->elevInfo 		  = yyvsp[-7].elevinfodef;
@@ -1781,7 +1781,7 @@ case 64:
 case 65:
 #line 796 "parser.y"
 {
-			yyval.intersectionsptr = calloc(1, sizeof(TIntersection));
+			yyval.intersectionsptr = LriArenaAlloc(sizeof(TIntersection));
 
 			strncpy(yyval.intersectionsptr->name, yyvsp[-6].strval, cMAX_WORDLENGTH);
 			yyval.intersectionsptr->elevInfo 		  = yyvsp[-5].elevinfodef;
@@ -1807,7 +1807,7 @@ case 67:
 case 68:
 #line 825 "parser.y"
 {
-			TRoadName* pTemp = malloc(sizeof(TRoadName));
+			TRoadName* pTemp = LriArenaAlloc(sizeof(TRoadName));
 
 			strncpy (pTemp->roadName, yyvsp[0].strval, cMAX_WORDLENGTH);
 			pTemp->pNextRoadName = yyval.roadptr;
@@ -1817,7 +1817,7 @@ case 68:
 case 69:
 #line 834 "parser.y"
 {
-			TRoadName* pTemp = calloc(1, sizeof(TRoadName));
+			TRoadName* pTemp = LriArenaAlloc(sizeof(TRoadName));
 
 			strncpy (pTemp->roadName, yyvsp[0].strval, cMAX_WORDLENGTH);
 			yyval.roadptr = pTemp;
@@ -1853,7 +1853,7 @@ case 73:
 case 74:
 #line 875 "parser.y"
 {
-			TAttribute *pNew = malloc(sizeof(TAttribute));
+			TAttribute *pNew = LriArenaAlloc(sizeof(TAttribute));
 
 			*pNew = yyvsp[0].attributedef;
 			pNew->pNext = yyval.attributeptr;
@@ -1863,7 +1863,7 @@ case 74:
 case 75:
 #line 885 "parser.y"
 {
-			yyval.attributeptr = malloc(sizeof(TAttribute));
+			yyval.attributeptr = LriArenaAlloc(sizeof(TAttribute));
 			*yyval.attributeptr = yyvsp[0].attributedef;
 		}
     break;
@@ -1923,7 +1923,7 @@ case 81:
 case 82:
 #line 955 "parser.y"
 {
-			TCrdr *pC = malloc(sizeof(*pC));
+			TCrdr *pC = LriArenaAlloc(sizeof(*pC));
 
 			*pC = yyvsp[0].crdrdef;
 			pC->pNext = yyval.crdrdefptr;
@@ -1933,7 +1933,7 @@ case 82:
 case 83:
 #line 964 "parser.y"
 {
-			TCrdr *pC = calloc(1, sizeof(*pC));
+			TCrdr *pC = LriArenaAlloc(sizeof(*pC));
 
 			*pC = yyvsp[0].crdrdef;
 			yyval.crdrdefptr =  pC;
@@ -1972,7 +1972,7 @@ case 86:
 case 87:
 #line 1012 "parser.y"
 {
-			THoldOfs *pH = malloc(sizeof(*pH));
+			THoldOfs *pH = LriArenaAlloc(sizeof(*pH));
 
 			*pH = yyvsp[0].holdofs;
 			pH->pNextHoldOfs = yyval.holdofsptr;
@@ -1982,7 +1982,7 @@ case 87:
 case 88:
 #line 1021 "parser.y"
 {
-			THoldOfs *pH = calloc(1, sizeof(*pH));
+			THoldOfs *pH = LriArenaAlloc(sizeof(*pH));
 
 			*pH = yyvsp[0].holdofs;
 			yyval.holdofsptr =  pH;
@@ -2070,7 +2070,7 @@ case 95:
 case 96:
 #line 1119 "parser.y"
 {
-			yyval.crdrlineinfoptr = calloc(1, sizeof(TCrdrLineInfo));
+			yyval.crdrlineinfoptr = LriArenaAlloc(sizeof(TCrdrLineInfo));
 			yyval.crdrlineinfoptr->lflag1 = yyvsp[-3].ival;
 			strncpy (yyval.crdrlineinfoptr->lstyle1, yyvsp[-2].strval, cMAX_WORDLENGTH);
 			yyval.crdrlineinfoptr->lflag2 = yyvsp[-1].ival;
@@ -2098,7 +2098,7 @@ case 99:
 case 100:
 #line 1149 "parser.y"
 {
-			TAttribute *pNew = malloc(sizeof(TAttribute));
+			TAttribute *pNew = LriArenaAlloc(sizeof(TAttribute));
 
 			*pNew = yyvsp[0].attributedef;
 			pNew->pNext = yyval.attributeptr;
@@ -2108,7 +2108,7 @@ case 100:
 case 101:
 #line 1159 "parser.y"
 {
-			yyval.attributeptr = malloc(sizeof(TAttribute));
+			yyval.attributeptr = LriArenaAlloc(sizeof(TAttribute));
 
 			*yyval.attributeptr = yyvsp[0].attributedef;
 		}